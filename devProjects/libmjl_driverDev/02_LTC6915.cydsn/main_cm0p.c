@@ -199,6 +199,9 @@ uint32_t initHardware(void) {
   uartCfg.hal_req_read = uart_psoc6SCB_read;
   uartCfg.hal_opt_externalStart = uart_psoc6SCB_start;
   uartCfg.hal_opt_externalStop = uart_psoc6SCB_stop;
+  #ifdef USE_UART_DMA
+    uartCfg.hal_opt_dmaStart = uart_psoc6SCB_dmaStart;
+  #endif /* USE_UART_DMA */
   error |= uart_init(&usb, &uartCfg);
   error |= uart_start(&usb);
     
@@ -208,11 +211,18 @@ uint32_t initHardware(void) {
   spiCfg.opt_hal_externalStop = spi_psoc6SCB_stop;
   spiCfg.req_hal_writeArray_blocking = spi_psoc6SCB_writeArray_blocking;
   spiCfg.req_hal_read = spi_psoc6SCB_read;
+  spiCfg.opt_hal_readArray = spi_psoc6SCB_readArray;
   spiCfg.req_hal_setActive = spi_psoc6SCB_setActive;
   spiCfg.req_hal_getRxBufferNum = spi_psoc6SCB_getRxBufferNum;
   spiCfg.req_hal_getTxBufferNum = spi_psoc6SCB_getTxBufferNum;
   spiCfg.req_hal_clearRxBuffer = spi_psoc6SCB_clearRxBuffer;
   spiCfg.req_hal_clearTxBuffer = spi_psoc6SCB_clearTxBuffer;
+  #ifdef USE_SPI_DMA
+    spiCfg.opt_hal_dmaStart = spi_psoc6SCB_dmaStart;
+    spiCfg.opt_hal_dmaAbort = spi_psoc6SCB_dmaAbort;
+    spiCfg.opt_hal_criticalEnter = critical_psoc6_enter;
+    spiCfg.opt_hal_criticalExit = critical_psoc6_exit;
+  #endif /* USE_SPI_DMA */
   error |= spi_init(&spi, &spiCfg);
   error |= spi_start(&spi);
   
@@ -0,0 +1,950 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: hal_host.c
+* Workspace: MJL Hardware Abstraction Layer (HAL) Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Simulated peripherals so the MJL drivers can be built and exercised
+*   off target with the host compiler
+*
+*   Example interrupt driven loop for the SPI transaction queue
+*     spi_hostSCB_setAutoShift(false);
+*     while(!spi_isQueueIdle(&spi)){
+*       spi_hostSCB_shift(1);
+*       if(spi_hostSCB_isIrqPending()){spi_serviceQueue(&spi);}
+*       if(spi_hostSCB_isDmaIrqPending()){spi_hostSCB_dmaIsr();}
+*     }
+*
+*   The simulated DMA moves bytes between memory and the SPI FIFOs as the
+*   wire shifts, and the UART model captures what is written so tests can
+*   check it.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "hal_host.h"
+#include "mjl_errors.h"
+#include <string.h>
+
+/* Simple byte FIFO modelling one direction of the SCB */
+typedef struct {
+  uint8_t data[HAL_HOST_SPI_FIFO_DEPTH];
+  uint16_t head;
+  uint16_t num;
+} HAL_HOST_FIFO_S;
+
+static HAL_HOST_FIFO_S spi_txFifo;
+static HAL_HOST_FIFO_S spi_rxFifo;
+static uint8_t spi_activeId = 0;
+static bool spi_irqEnabled = false;
+static bool spi_csAsserted = false;
+static const MJL_SPI_DEVICE_S *spi_device = NULL;
+static bool spi_autoShift = true;
+static uint8_t (*spi_fn_exchange)(uint8_t id, uint8_t mosi) = NULL;
+static HAL_HOST_SPI_STATS_S spi_stats;
+/* Simulated DMA channel pair of the SPI */
+static MJL_DMA_DESC_S *spi_dmaDesc = NULL;
+static uint16_t spi_dmaTxIdx = 0;
+static uint16_t spi_dmaRxIdx = 0;
+static bool spi_dmaIrqPending = false;
+/* Simulated UART */
+static uint8_t uart_capture[HAL_HOST_UART_CAPTURE_LEN];
+static uint16_t uart_captureLen = 0;
+static uint8_t uart_rx[HAL_HOST_UART_RX_LEN];
+static uint16_t uart_rxHead = 0;
+static uint16_t uart_rxNum = 0;
+static MJL_DMA_DESC_S *uart_dmaDesc = NULL;
+static uint16_t uart_dmaIdx = 0;
+static bool uart_dmaIrqPending = false;
+static uint16_t uart_txFifoNum = 0;
+static bool uart_txIrqEnabled = false;
+static bool uart_rxIrqEnabled = false;
+static HAL_HOST_UART_STATS_S uart_stats;
+
+static void spi_hostDma_step(void);
+static void uart_hostCapture(uint8_t data);
+
+static bool hal_host_fifoPush(HAL_HOST_FIFO_S *const fifo, uint8_t data){
+  if(fifo->num >= HAL_HOST_SPI_FIFO_DEPTH){return false;}
+  fifo->data[(fifo->head + fifo->num) % HAL_HOST_SPI_FIFO_DEPTH] = data;
+  fifo->num++;
+  return true;
+}
+
+static bool hal_host_fifoPop(HAL_HOST_FIFO_S *const fifo, uint8_t *data){
+  if(0 == fifo->num){return false;}
+  *data = fifo->data[fifo->head];
+  fifo->head = (fifo->head + 1) % HAL_HOST_SPI_FIFO_DEPTH;
+  fifo->num--;
+  return true;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_start()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Start the block with empty FIFOs
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_start(MJL_SPI_T *const state){
+  uint32_t error = 0;
+  (void) state;
+  spi_txFifo.num = 0;
+  spi_rxFifo.num = 0;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_stop()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Stop the block and mask the interrupt
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_stop(MJL_SPI_T *const state){
+  uint32_t error = 0;
+  (void) state;
+  spi_irqEnabled = false;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_writeArray_blocking()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Place an array in the TX FIFO, shifting bytes out while it is full
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_writeArray_blocking(const uint8_t *array, uint16_t len){
+  uint32_t error = 0;
+  for(uint16_t i = 0; i < len; i++){
+    while(!hal_host_fifoPush(&spi_txFifo, array[i])){
+      spi_hostSCB_shift(1);
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_read()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Place one element from the RX FIFO into the results buffer
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_read(uint8_t *result){
+  uint32_t error = 0;
+  if(!hal_host_fifoPop(&spi_rxFifo, result)){error|=ERROR_UNAVAILABLE;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_readArray()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Move len elements from the RX FIFO into the results buffer
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_readArray(uint8_t *result, uint16_t len){
+  uint32_t error = 0;
+  for(uint16_t i = 0; i < len; i++){
+    if(!hal_host_fifoPop(&spi_rxFifo, &result[i])){
+      error|=ERROR_UNAVAILABLE;
+      break;
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_setActive()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Sets the slave that receives the following bytes
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_setActive(uint8_t id){
+  uint32_t error = 0;
+  spi_activeId = id;
+  spi_stats.selects++;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_getRxBufferNum()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Return the number of elements in the receive FIFO. With auto shift enabled
+*   each poll moves one byte across the wire, so busy-wait loops make progress
+*
+* \return
+*  Number of elements in the receive FIFO
+*******************************************************************************/
+uint32_t spi_hostSCB_getRxBufferNum(void){
+  if(spi_autoShift){spi_hostSCB_shift(1);}
+  return spi_rxFifo.num;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_getTxBufferNum()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Return the number of elements in the transmit FIFO. With auto shift enabled
+*   each poll moves one byte across the wire, so busy-wait loops make progress
+*
+* \return
+*  Number of elements in the transmit FIFO
+*******************************************************************************/
+uint32_t spi_hostSCB_getTxBufferNum(void){
+  if(spi_autoShift){spi_hostSCB_shift(1);}
+  return spi_txFifo.num;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_clearRxBuffer()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Clear all of the elements in the receive FIFO
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_clearRxBuffer(void){
+  uint32_t error = 0;
+  spi_rxFifo.num = 0;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_clearTxBuffer()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Clear all of the elements in the transmit FIFO
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_clearTxBuffer(void){
+  uint32_t error = 0;
+  spi_txFifo.num = 0;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_setIrq()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Enable or disable the RX FIFO not-empty interrupt
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_setIrq(bool enable){
+  uint32_t error = 0;
+  if(enable){spi_stats.irqEnables++;}
+  spi_irqEnabled = enable;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_csAssert()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Assert a software chip select. Asserting one that is already held is an
+*   error, as it would be a missing release on the target
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_csAssert(uint8_t id){
+  uint32_t error = 0;
+  if(spi_csAsserted){error|=ERROR_STATE;}
+  spi_activeId = id;
+  spi_csAsserted = true;
+  spi_stats.csAsserts++;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_csDeassert()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Release the software chip select
+*
+*******************************************************************************/
+void spi_hostSCB_csDeassert(void){
+  spi_csAsserted = false;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_configure()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Apply the clock, mode and chip select polarity of a device. Changing them 
+*   while bytes are on the wire is an error.
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_configure(const MJL_SPI_DEVICE_S *device){
+  uint32_t error = 0;
+  if((spi_txFifo.num > 0) || spi_csAsserted){error|=ERROR_STATE;}
+  spi_device = device;
+  spi_stats.configures++;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_reset()
+********************************************************************************
+* \brief
+*   Return the simulated SPI to its power on state, with a loopback responder
+*   and auto shift enabled
+*
+*******************************************************************************/
+void spi_hostSCB_reset(void){
+  memset(&spi_txFifo, 0, sizeof(spi_txFifo));
+  memset(&spi_rxFifo, 0, sizeof(spi_rxFifo));
+  memset(&spi_stats, 0, sizeof(spi_stats));
+  spi_activeId = 0;
+  spi_irqEnabled = false;
+  spi_csAsserted = false;
+  spi_device = NULL;
+  spi_autoShift = true;
+  spi_fn_exchange = NULL;
+  spi_dmaDesc = NULL;
+  spi_dmaIrqPending = false;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_setResponder()
+********************************************************************************
+* \brief
+*   Set the model of the slave devices. It is called once per byte with the
+*   active slave ID and the byte sent, and returns the byte clocked back.
+*   NULL loops MOSI back to MISO.
+*
+* \param fn_exchange [in]
+*   Slave model
+*
+*******************************************************************************/
+void spi_hostSCB_setResponder(uint8_t (*fn_exchange)(uint8_t id, uint8_t mosi)){
+  spi_fn_exchange = fn_exchange;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_setAutoShift()
+********************************************************************************
+* \brief
+*   Select whether polling the FIFO levels advances the wire. Disable to drive
+*   the wire explicitly with spi_hostSCB_shift(), as in an interrupt driven test
+*
+* \param enable [in]
+*   True to shift one byte per FIFO level poll
+*
+*******************************************************************************/
+void spi_hostSCB_setAutoShift(bool enable){
+  spi_autoShift = enable;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_shift()
+********************************************************************************
+* \brief
+*   Move up to num bytes from the TX FIFO across the wire into the RX FIFO
+*
+* \param num [in]
+*   Maximum number of bytes to shift
+*
+* \return
+*  Number of bytes shifted
+*******************************************************************************/
+uint16_t spi_hostSCB_shift(uint16_t num){
+  uint16_t shifted = 0;
+  uint8_t mosi = 0;
+  while((shifted < num) && hal_host_fifoPop(&spi_txFifo, &mosi)){
+    uint8_t miso = (NULL == spi_fn_exchange) ? mosi : spi_fn_exchange(spi_activeId, mosi);
+    if(!hal_host_fifoPush(&spi_rxFifo, miso)){
+      spi_stats.rxOverflow++;
+    }
+    spi_stats.bytesShifted++;
+    shifted++;
+    /* The DMA reacts to every FIFO level change */
+    spi_hostDma_step();
+  }
+  return shifted;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_isIrqPending()
+********************************************************************************
+* \brief
+*   Check if the simulated SPI interrupt would fire
+*
+* \return
+*  True if the interrupt is enabled and the RX FIFO is not empty
+*******************************************************************************/
+bool spi_hostSCB_isIrqPending(void){
+  return spi_irqEnabled && (spi_rxFifo.num > 0);
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_isCsAsserted()
+********************************************************************************
+* \brief
+*   Check if the software chip select is held
+*
+* \return
+*  True if asserted
+*******************************************************************************/
+bool spi_hostSCB_isCsAsserted(void){
+  return spi_csAsserted;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_getDevice()
+********************************************************************************
+* \brief
+*   Get the device whose settings were applied last
+*
+* \return
+*  Device descriptor, NULL if none has been applied
+*******************************************************************************/
+const MJL_SPI_DEVICE_S *spi_hostSCB_getDevice(void){
+  return spi_device;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_dmaStart()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Start the TX and RX DMA channels on a descriptor. The TX channel fills the
+*   TX FIFO whenever it has room and the RX channel empties the RX FIFO after
+*   every byte shifted. Once all bytes are received the DMA interrupt is
+*   pending, see spi_hostSCB_dmaIsr().
+*
+* \param desc [in/out]
+*   Descriptor of the transfer, owned by the DMA until its completion
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostSCB_dmaStart(MJL_DMA_DESC_S *const desc){
+  uint32_t error = 0;
+  if(NULL == desc){error|=ERROR_POINTER;}
+  else if(0 == desc->len){error|=ERROR_VAL;}
+  else if((NULL != spi_dmaDesc) || spi_dmaIrqPending){error|=ERROR_RUNNING;}
+  if(!error){
+    spi_dmaDesc = desc;
+    spi_dmaTxIdx = 0;
+    spi_dmaRxIdx = 0;
+    spi_stats.dmaStarts++;
+    spi_hostDma_step();
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_dmaAbort()
+********************************************************************************
+* \brief
+*   Simulated SCB based SPI
+*   Stop the DMA channels without completing the descriptor
+*
+*******************************************************************************/
+void spi_hostSCB_dmaAbort(void){
+  spi_dmaDesc = NULL;
+  spi_dmaIrqPending = false;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_isDmaIrqPending()
+********************************************************************************
+* \brief
+*   Check if the simulated DMA completion interrupt would fire
+*
+* \return
+*  True if a descriptor has finished and spi_hostSCB_dmaIsr() has not run
+*******************************************************************************/
+bool spi_hostSCB_isDmaIrqPending(void){
+  return spi_dmaIrqPending;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_dmaIsr()
+********************************************************************************
+* \brief
+*   Simulated DMA completion interrupt, call when spi_hostSCB_isDmaIrqPending()
+*   returns true. Hands the descriptor back through mjl_dma_complete()
+*
+*******************************************************************************/
+void spi_hostSCB_dmaIsr(void){
+  if(spi_dmaIrqPending){
+    MJL_DMA_DESC_S *desc = spi_dmaDesc;
+    spi_dmaIrqPending = false;
+    spi_dmaDesc = NULL;
+    mjl_dma_complete(desc, ERROR_NONE);
+  }
+}
+
+/*******************************************************************************
+* Function Name: spi_hostDma_step()
+********************************************************************************
+* \brief
+*   Let the DMA channels react to the FIFO levels
+*
+*******************************************************************************/
+static void spi_hostDma_step(void){
+  if((NULL == spi_dmaDesc) || spi_dmaIrqPending){return;}
+  MJL_DMA_DESC_S *desc = spi_dmaDesc;
+  uint8_t data = 0;
+  /* RX channel, triggered by a non empty RX FIFO */
+  while((spi_dmaRxIdx < spi_dmaTxIdx) && hal_host_fifoPop(&spi_rxFifo, &data)){
+    if(NULL != desc->rx){desc->rx[spi_dmaRxIdx] = data;}
+    spi_dmaRxIdx++;
+    spi_stats.dmaBytes++;
+  }
+  /* TX channel, triggered while the TX FIFO has room */
+  while(spi_dmaTxIdx < desc->len){
+    data = (NULL == desc->tx) ? MJL_DMA_DUMMY_BYTE : desc->tx[spi_dmaTxIdx];
+    if(!hal_host_fifoPush(&spi_txFifo, data)){break;}
+    spi_dmaTxIdx++;
+  }
+  if(spi_dmaRxIdx >= desc->len){
+    spi_dmaIrqPending = true;
+  }
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_getTicks()
+********************************************************************************
+* \brief
+*   Simulated time base for opt_hal_getTicks, one tick per byte on the wire
+*
+* \return
+*  Bytes shifted since the last reset
+*******************************************************************************/
+uint32_t spi_hostSCB_getTicks(void){
+  return spi_stats.bytesShifted;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostSCB_getStats()
+********************************************************************************
+* \brief
+*   Copy out the wire level statistics
+*
+* \param stats [out]
+*   Destination of the statistics
+*
+*******************************************************************************/
+void spi_hostSCB_getStats(HAL_HOST_SPI_STATS_S *const stats){
+  *stats = spi_stats;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_start()
+********************************************************************************
+* \brief
+*   Simulated SCB based UART
+*   Start the block. The capture and injected bytes are kept, clear them with
+*   uart_hostSCB_reset()
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_hostSCB_start(MLJ_UART_T *const state){
+  uint32_t error = 0;
+  (void) state;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_stop()
+********************************************************************************
+* \brief
+*   Simulated SCB based UART
+*   Stop the block, dropping a running DMA transfer
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_hostSCB_stop(MLJ_UART_T *const state){
+  uint32_t error = 0;
+  (void) state;
+  uart_dmaDesc = NULL;
+  uart_dmaIrqPending = false;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_writeArrayBlocking()
+********************************************************************************
+* \brief
+*   Simulated SCB based UART
+*   Append an array to the capture. The bytes are captured as written, the 
+*   last HAL_HOST_UART_FIFO_DEPTH of them wait in the TX FIFO. Writing while a 
+*   DMA transfer owns the TX FIFO is an error, the bytes would interleave on 
+*   the target.
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_hostSCB_writeArrayBlocking(const uint8_t *array, uint16_t len){
+  uint32_t error = 0;
+  if(NULL != uart_dmaDesc){error|=ERROR_STATE;}
+  for(uint16_t i = 0; i < len; i++){
+    uart_hostCapture(array[i]);
+  }
+  /* A blocking write waits until the rest has shifted */
+  uint32_t fifoNum = (uint32_t) uart_txFifoNum + len;
+  uart_txFifoNum = (fifoNum > HAL_HOST_UART_FIFO_DEPTH) ? HAL_HOST_UART_FIFO_DEPTH : (uint16_t) fifoNum;
+  uart_stats.writes++;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_read()
+********************************************************************************
+* \brief
+*   Simulated SCB based UART
+*   Read a single element injected with uart_hostSCB_inject()
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_hostSCB_read(uint8_t *data){
+  uint32_t error = 0;
+  if(0 == uart_rxNum){error|=ERROR_UNAVAILABLE;}
+  else {
+    *data = uart_rx[uart_rxHead];
+    uart_rxHead = (uart_rxHead + 1) % HAL_HOST_UART_RX_LEN;
+    uart_rxNum--;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_dmaStart()
+********************************************************************************
+* \brief
+*   Simulated SCB based UART
+*   Start the TX DMA channel on a descriptor. Bytes move to the capture with
+*   uart_hostSCB_shift(), then the DMA interrupt is pending.
+*
+* \param desc [in/out]
+*   Descriptor of the transfer, owned by the DMA until its completion
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_hostSCB_dmaStart(MJL_DMA_DESC_S *const desc){
+  uint32_t error = 0;
+  if(NULL == desc){error|=ERROR_POINTER;}
+  else if((NULL == desc->tx) || (0 == desc->len)){error|=ERROR_VAL;}
+  else if((NULL != uart_dmaDesc) || uart_dmaIrqPending){error|=ERROR_RUNNING;}
+  if(!error){
+    uart_dmaDesc = desc;
+    uart_dmaIdx = 0;
+    uart_stats.dmaStarts++;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_getTxFree()
+********************************************************************************
+* \brief
+*   Simulated SCB based UART
+*   Free space in the TX FIFO, a write of up to this many bytes returns 
+*   without waiting
+*
+* \return
+*  Number of free bytes
+*******************************************************************************/
+uint32_t uart_hostSCB_getTxFree(void){
+  return HAL_HOST_UART_FIFO_DEPTH - uart_txFifoNum;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_setTxIrq()
+********************************************************************************
+* \brief
+*   Simulated SCB based UART
+*   Enable or disable the TX FIFO not full interrupt, see 
+*   uart_hostSCB_isTxIrqPending()
+*
+* \param enable [in]
+*   True to enable the interrupt source
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_hostSCB_setTxIrq(bool enable){
+  uint32_t error = 0;
+  uart_txIrqEnabled = enable;
+  if(enable){uart_stats.txIrqEnables++;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_isTxIrqPending()
+********************************************************************************
+* \brief
+*   Check if the simulated TX FIFO not full interrupt would fire. The test 
+*   then calls the handler, uart_txIsr()
+*
+* \return
+*  True if the interrupt is enabled and the TX FIFO has space
+*******************************************************************************/
+bool uart_hostSCB_isTxIrqPending(void){
+  return uart_txIrqEnabled && (uart_txFifoNum < HAL_HOST_UART_FIFO_DEPTH);
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_setRxIrq()
+********************************************************************************
+* \brief
+*   Simulated SCB based UART
+*   Enable or disable the RX FIFO not empty interrupt, see 
+*   uart_hostSCB_isRxIrqPending()
+*
+* \param enable [in]
+*   True to enable the interrupt source
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_hostSCB_setRxIrq(bool enable){
+  uint32_t error = 0;
+  uart_rxIrqEnabled = enable;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_isRxIrqPending()
+********************************************************************************
+* \brief
+*   Check if the simulated RX FIFO not empty interrupt would fire. The test 
+*   then calls the handler, uart_rxIsr()
+*
+* \return
+*  True if the interrupt is enabled and injected bytes are waiting
+*******************************************************************************/
+bool uart_hostSCB_isRxIrqPending(void){
+  return uart_rxIrqEnabled && (0 != uart_rxNum);
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_shift()
+********************************************************************************
+* \brief
+*   Move up to num bytes of the TX FIFO, then of the running DMA transfer, 
+*   onto the line
+*
+* \param num [in]
+*   Maximum number of bytes to send
+*
+* \return
+*  Number of bytes sent
+*******************************************************************************/
+uint16_t uart_hostSCB_shift(uint16_t num){
+  uint16_t shifted = 0;
+  while((shifted < num) && (uart_txFifoNum > 0)){
+    uart_txFifoNum--;
+    shifted++;
+  }
+  while((shifted < num) && (NULL != uart_dmaDesc) && !uart_dmaIrqPending){
+    uart_hostCapture(uart_dmaDesc->tx[uart_dmaIdx]);
+    uart_dmaIdx++;
+    shifted++;
+    if(uart_dmaIdx >= uart_dmaDesc->len){
+      uart_dmaIrqPending = true;
+    }
+  }
+  return shifted;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_isDmaIrqPending()
+********************************************************************************
+* \brief
+*   Check if the simulated UART DMA completion interrupt would fire
+*
+* \return
+*  True if a descriptor has finished and uart_hostSCB_dmaIsr() has not run
+*******************************************************************************/
+bool uart_hostSCB_isDmaIrqPending(void){
+  return uart_dmaIrqPending;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_dmaIsr()
+********************************************************************************
+* \brief
+*   Simulated UART DMA completion interrupt. Hands the descriptor back through 
+*   mjl_dma_complete()
+*
+*******************************************************************************/
+void uart_hostSCB_dmaIsr(void){
+  if(uart_dmaIrqPending){
+    MJL_DMA_DESC_S *desc = uart_dmaDesc;
+    uart_dmaIrqPending = false;
+    uart_dmaDesc = NULL;
+    mjl_dma_complete(desc, ERROR_NONE);
+  }
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_reset()
+********************************************************************************
+* \brief
+*   Return the simulated UART to its power on state
+*
+*******************************************************************************/
+void uart_hostSCB_reset(void){
+  uart_captureLen = 0;
+  uart_rxHead = 0;
+  uart_rxNum = 0;
+  uart_dmaDesc = NULL;
+  uart_dmaIrqPending = false;
+  uart_txFifoNum = 0;
+  uart_txIrqEnabled = false;
+  uart_rxIrqEnabled = false;
+  memset(&uart_stats, 0, sizeof(uart_stats));
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_inject()
+********************************************************************************
+* \brief
+*   Queue bytes as if received on the line
+*
+* \param data [in]
+*   Bytes to receive
+*
+* \param len [in]
+*   Number of bytes
+*
+* \return
+*  Error code of the operation, ERROR_UNAVAILABLE if some did not fit
+*******************************************************************************/
+uint32_t uart_hostSCB_inject(const uint8_t *data, uint16_t len){
+  uint32_t error = 0;
+  for(uint16_t i = 0; i < len; i++){
+    if(uart_rxNum >= HAL_HOST_UART_RX_LEN){
+      error|=ERROR_UNAVAILABLE;
+      break;
+    }
+    uart_rx[(uart_rxHead + uart_rxNum) % HAL_HOST_UART_RX_LEN] = data[i];
+    uart_rxNum++;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_getCapture()
+********************************************************************************
+* \brief
+*   Access the bytes written so far
+*
+* \param len [out]
+*   Number of bytes captured
+*
+* \return
+*  Captured bytes, not terminated
+*******************************************************************************/
+const uint8_t *uart_hostSCB_getCapture(uint16_t *len){
+  *len = uart_captureLen;
+  return uart_capture;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_clearCapture()
+********************************************************************************
+* \brief
+*   Discard the captured bytes
+*
+*******************************************************************************/
+void uart_hostSCB_clearCapture(void){
+  uart_captureLen = 0;
+}
+
+/*******************************************************************************
+* Function Name: uart_hostSCB_getStats()
+********************************************************************************
+* \brief
+*   Copy out the UART statistics
+*
+* \param stats [out]
+*   Destination of the statistics
+*
+*******************************************************************************/
+void uart_hostSCB_getStats(HAL_HOST_UART_STATS_S *const stats){
+  *stats = uart_stats;
+}
+
+/* Record one byte on the line, counting what does not fit */
+static void uart_hostCapture(uint8_t data){
+  if(uart_captureLen < HAL_HOST_UART_CAPTURE_LEN){
+    uart_capture[uart_captureLen++] = data;
+  } else {
+    uart_stats.captureOverflow++;
+  }
+  uart_stats.bytes++;
+}
+
+/*******************************************************************************
+* Function Name: critical_host_enter()
+********************************************************************************
+* \brief
+*   Critical section hook. The simulation runs interrupts only where the test
+*   calls them, so there is nothing to disable.
+*
+* \return
+*  Previous interrupt state, pass to critical_host_exit()
+*******************************************************************************/
+uint32_t critical_host_enter(void){
+  return 0;
+}
+
+/*******************************************************************************
+* Function Name: critical_host_exit()
+********************************************************************************
+* \brief
+*   Leave a critical section entered with critical_host_enter()
+*
+*******************************************************************************/
+void critical_host_exit(uint32_t intState){
+  (void) intState;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,122 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: hal_host.h
+* Workspace: MJL Hardware Abstraction Layer (HAL) Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Simulated peripherals so the MJL drivers can be built and exercised
+*   off target with the host compiler. The SPI model is an SCB with TX and RX
+*   FIFOs joined by a wire that moves one byte per shift. Bytes received with a
+*   full RX FIFO are dropped and counted, as on the hardware. DMA channels
+*   move data between memory and the FIFOs as the wire shifts. The UART model
+*   captures what is written and receives injected bytes. Its TX FIFO empties
+*   as the line shifts.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef HAL_HOST_H
+  #define HAL_HOST_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdint.h>
+  #include <stdbool.h>
+  #include "mjl_spi.h"
+  #include "mjl_uart.h"
+  #include "mjl_dma.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define HAL_HOST_SPI_FIFO_DEPTH   (8)
+  #define HAL_HOST_UART_CAPTURE_LEN (4096)  /* Bytes of UART output kept for inspection */
+  #define HAL_HOST_UART_RX_LEN      (256)   /* Injected bytes waiting to be read */
+  #define HAL_HOST_UART_FIFO_DEPTH  (8)     /* Bytes in the TX FIFO */
+  /***************************************
+  * Enumerated types
+  ***************************************/
+
+  /***************************************
+  * Structures
+  ***************************************/
+  /* Wire level statistics of the simulated SPI */
+  typedef struct {
+    uint32_t bytesShifted;    /* Bytes moved across the wire */
+    uint32_t rxOverflow;      /* Bytes dropped because the RX FIFO was full */
+    uint32_t selects;         /* Calls to the set active hook */
+    uint32_t irqEnables;      /* Calls enabling the interrupt */
+    uint32_t csAsserts;       /* Software chip select assertions */
+    uint32_t configures;      /* Calls applying device settings */
+    uint32_t dmaStarts;       /* Descriptors started */
+    uint32_t dmaBytes;        /* Bytes received by the DMA */
+  } HAL_HOST_SPI_STATS_S;
+  /* Statistics of the simulated UART */
+  typedef struct {
+    uint32_t bytes;           /* Bytes sent */
+    uint32_t writes;          /* Calls to the blocking write */
+    uint32_t dmaStarts;       /* Descriptors started */
+    uint32_t captureOverflow; /* Bytes sent after the capture filled */
+    uint32_t txIrqEnables;    /* Calls enabling the TX interrupt */
+  } HAL_HOST_UART_STATS_S;
+  /***************************************
+  * Function declarations
+  ***************************************/
+  /* MJL_SPI_S hooks */
+  uint32_t spi_hostSCB_start(MJL_SPI_T *const state);
+  uint32_t spi_hostSCB_stop(MJL_SPI_T *const state);
+  uint32_t spi_hostSCB_writeArray_blocking(const uint8_t *array, uint16_t len);
+  uint32_t spi_hostSCB_read(uint8_t *result);
+  uint32_t spi_hostSCB_readArray(uint8_t *result, uint16_t len);
+  uint32_t spi_hostSCB_setActive(uint8_t id);
+  uint32_t spi_hostSCB_getRxBufferNum(void);
+  uint32_t spi_hostSCB_getTxBufferNum(void);
+  uint32_t spi_hostSCB_clearRxBuffer(void);
+  uint32_t spi_hostSCB_clearTxBuffer(void);
+  uint32_t spi_hostSCB_setIrq(bool enable);
+  uint32_t spi_hostSCB_csAssert(uint8_t id);
+  void spi_hostSCB_csDeassert(void);
+  uint32_t spi_hostSCB_configure(const MJL_SPI_DEVICE_S *device);
+  uint32_t spi_hostSCB_getTicks(void);
+  uint32_t spi_hostSCB_dmaStart(MJL_DMA_DESC_S *const desc);
+  void spi_hostSCB_dmaAbort(void);
+  /* Simulation control */
+  void spi_hostSCB_reset(void);
+  void spi_hostSCB_setResponder(uint8_t (*fn_exchange)(uint8_t id, uint8_t mosi));
+  void spi_hostSCB_setAutoShift(bool enable);
+  uint16_t spi_hostSCB_shift(uint16_t num);
+  bool spi_hostSCB_isIrqPending(void);
+  bool spi_hostSCB_isCsAsserted(void);
+  const MJL_SPI_DEVICE_S *spi_hostSCB_getDevice(void);
+  void spi_hostSCB_getStats(HAL_HOST_SPI_STATS_S *const stats);
+  bool spi_hostSCB_isDmaIrqPending(void);
+  void spi_hostSCB_dmaIsr(void);
+
+  /* MLJ_UART_S hooks */
+  uint32_t uart_hostSCB_start(MLJ_UART_T *const state);
+  uint32_t uart_hostSCB_stop(MLJ_UART_T *const state);
+  uint32_t uart_hostSCB_writeArrayBlocking(const uint8_t *array, uint16_t len);
+  uint32_t uart_hostSCB_read(uint8_t *data);
+  uint32_t uart_hostSCB_dmaStart(MJL_DMA_DESC_S *const desc);
+  uint32_t uart_hostSCB_getTxFree(void);
+  uint32_t uart_hostSCB_setTxIrq(bool enable);
+  uint32_t uart_hostSCB_setRxIrq(bool enable);
+  /* Simulation control */
+  void uart_hostSCB_reset(void);
+  uint16_t uart_hostSCB_shift(uint16_t num);
+  bool uart_hostSCB_isTxIrqPending(void);
+  bool uart_hostSCB_isRxIrqPending(void);
+  bool uart_hostSCB_isDmaIrqPending(void);
+  void uart_hostSCB_dmaIsr(void);
+  uint32_t uart_hostSCB_inject(const uint8_t *data, uint16_t len);
+  const uint8_t *uart_hostSCB_getCapture(uint16_t *len);
+  void uart_hostSCB_clearCapture(void);
+  void uart_hostSCB_getStats(HAL_HOST_UART_STATS_S *const stats);
+
+  /* Critical section hooks */
+  uint32_t critical_host_enter(void);
+  void critical_host_exit(uint32_t intState);
+
+#endif /* HAL_HOST_H */
+/* [] END OF FILE */
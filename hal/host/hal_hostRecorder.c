@@ -0,0 +1,611 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: hal_hostRecorder.c
+* Workspace: MJL Hardware Abstraction Layer (HAL) Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: SPI bus recorder and replayer for host analysis
+*
+*   Example, bytes and transactions of a display update
+*     spi_hostRec_reset();
+*     ssd1306Cfg.fn_spi_writeArrayBlocking = spi_hostRec_writeArrayBlocking;
+*     ssd1306Cfg.fn_spi_transferSegments = spi_hostRec_transferSegments;
+*     ssd1306Cfg.fn_pin_dataCommand_write = spi_hostRec_pinDataCommand;
+*     ssd1306Cfg.fn_pin_reset_write = spi_hostRec_pinReset;
+*     ssd1306Cfg.fn_delayUs = spi_hostRec_delayUs;
+*     ... run the driver ...
+*     spi_hostRec_printSummary(stdout);
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "hal_hostRecorder.h"
+#include "hal_host.h"
+#include "mjl_errors.h"
+#include <string.h>
+
+#define REC_FILE_MAGIC    "MJLREC1"   /* First bytes of a saved recording */
+#define REC_HEX_PER_LINE  (16)        /* Bytes printed per event */
+
+/* One recording */
+typedef struct {
+  HAL_HOST_REC_EVENT_S events[HAL_HOST_REC_EVENT_MAX];
+  uint32_t numEvents;
+  uint8_t mosi[HAL_HOST_REC_DATA_MAX];
+  uint8_t miso[HAL_HOST_REC_DATA_MAX];
+  uint32_t numData;
+  bool isFull;                  /* Something did not fit and was not logged */
+} HAL_HOST_REC_LOG_S;
+
+static HAL_HOST_REC_LOG_S rec_live;
+static HAL_HOST_REC_LOG_S rec_ref;
+static bool rec_isReplaying = false;
+static uint32_t rec_refIdx = 0;
+static uint32_t rec_mismatch[256];
+static uint32_t rec_underrun[256];
+static uint64_t rec_timeNs = 0;
+static uint32_t rec_byteNs = 8000;
+static uint8_t rec_csId = 0;
+static uint8_t (*rec_fn_exchange)(uint8_t id, uint8_t mosi) = NULL;
+
+static uint8_t spi_hostRec_wire(uint8_t id, uint8_t mosi);
+static uint8_t spi_hostRec_byte(uint8_t id, HAL_HOST_REC_TYPE_T type, uint8_t mosi);
+static void spi_hostRec_event(HAL_HOST_REC_TYPE_T type, uint8_t id, uint8_t arg, uint16_t len);
+static void spi_hostRec_bytes(uint8_t id, const uint8_t *tx, uint8_t *rx, uint16_t len);
+
+/*******************************************************************************
+* Function Name: spi_hostRec_writeArrayBlocking()
+********************************************************************************
+* \brief
+*   Driver tap, logs a write of len bytes as one chip select transaction
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostRec_writeArrayBlocking(uint8_t slaveId, const uint8_t *cmdArray, uint16_t len){
+  uint32_t error = 0;
+  if(NULL == cmdArray){error|=ERROR_POINTER;}
+  if(!error){
+    spi_hostRec_event(HAL_HOST_REC_CS_ASSERT, slaveId, 0, 0);
+    spi_hostRec_bytes(slaveId, cmdArray, NULL, len);
+    spi_hostRec_event(HAL_HOST_REC_CS_DEASSERT, slaveId, 0, 0);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_readArrayBlocking()
+********************************************************************************
+* \brief
+*   Driver tap, logs a read of len bytes as one chip select transaction. The
+*   bytes come from the responder, or from the recording when replaying
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostRec_readArrayBlocking(uint8_t slaveId, uint8_t *buffer, uint16_t len){
+  uint32_t error = 0;
+  if(NULL == buffer){error|=ERROR_POINTER;}
+  if(!error){
+    spi_hostRec_event(HAL_HOST_REC_CS_ASSERT, slaveId, 0, 0);
+    spi_hostRec_bytes(slaveId, NULL, buffer, len);
+    spi_hostRec_event(HAL_HOST_REC_CS_DEASSERT, slaveId, 0, 0);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_transferSegments()
+********************************************************************************
+* \brief
+*   Driver tap, logs the segments under one chip select. fn_before of each
+*   segment runs first, so a D/C pin tap logs its change in order
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostRec_transferSegments(uint8_t slaveId, const MJL_SPI_SEG_S *segs, uint8_t num){
+  uint32_t error = 0;
+  if(NULL == segs){error|=ERROR_POINTER;}
+  if(!error){
+    spi_hostRec_event(HAL_HOST_REC_CS_ASSERT, slaveId, 0, 0);
+    for(uint8_t i = 0; i < num; i++){
+      if(NULL != segs[i].fn_before){
+        segs[i].fn_before(segs[i].arg);
+      }
+      spi_hostRec_bytes(slaveId, segs[i].tx, segs[i].rx, segs[i].len);
+    }
+    spi_hostRec_event(HAL_HOST_REC_CS_DEASSERT, slaveId, 0, 0);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_pinDataCommand()
+********************************************************************************
+* \brief
+*   Driver tap, logs a D/C pin write. Only level changes count in the summary
+*
+*******************************************************************************/
+void spi_hostRec_pinDataCommand(uint8_t val){
+  spi_hostRec_event(HAL_HOST_REC_DC, rec_csId, val, 0);
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_pinReset()
+********************************************************************************
+* \brief
+*   Driver tap, logs a reset pin write
+*
+*******************************************************************************/
+void spi_hostRec_pinReset(uint8_t val){
+  spi_hostRec_event(HAL_HOST_REC_RESET, rec_csId, val, 0);
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_delayUs()
+********************************************************************************
+* \brief
+*   Driver tap, logs a delay and advances the virtual time by it
+*
+*******************************************************************************/
+void spi_hostRec_delayUs(uint16_t microsecond){
+  spi_hostRec_event(HAL_HOST_REC_DELAY, rec_csId, 0, microsecond);
+  rec_timeNs += (uint64_t) microsecond * 1000;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_setActive()
+********************************************************************************
+* \brief
+*   MJL_SPI_S hook, logs the slave selection and forwards it to the simulated
+*   SCB
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostRec_setActive(uint8_t id){
+  spi_hostRec_event(HAL_HOST_REC_SELECT, id, 0, 0);
+  return spi_hostSCB_setActive(id);
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_csAssert()
+********************************************************************************
+* \brief
+*   MJL_SPI_S hook, logs the chip select and forwards it to the simulated SCB
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostRec_csAssert(uint8_t id){
+  spi_hostRec_event(HAL_HOST_REC_CS_ASSERT, id, 0, 0);
+  return spi_hostSCB_csAssert(id);
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_csDeassert()
+********************************************************************************
+* \brief
+*   MJL_SPI_S hook, logs the chip select release and forwards it to the
+*   simulated SCB
+*
+*******************************************************************************/
+void spi_hostRec_csDeassert(void){
+  spi_hostRec_event(HAL_HOST_REC_CS_DEASSERT, rec_csId, 0, 0);
+  spi_hostSCB_csDeassert();
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_reset()
+********************************************************************************
+* \brief
+*   Clear the recording, the replay and the virtual time, and tap the wire of
+*   the simulated SCB. The responder is kept.
+*
+*******************************************************************************/
+void spi_hostRec_reset(void){
+  rec_live.numEvents = 0;
+  rec_live.numData = 0;
+  rec_live.isFull = false;
+  rec_isReplaying = false;
+  rec_refIdx = 0;
+  memset(rec_mismatch, 0, sizeof(rec_mismatch));
+  memset(rec_underrun, 0, sizeof(rec_underrun));
+  rec_timeNs = 0;
+  rec_csId = 0;
+  spi_hostSCB_setResponder(spi_hostRec_wire);
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_setClockHz()
+********************************************************************************
+* \brief
+*   Set the virtual bus clock used to timestamp bytes
+*
+* \param hz [in]
+*   Bus clock, 0 restores HAL_HOST_REC_CLOCK_HZ
+*
+*******************************************************************************/
+void spi_hostRec_setClockHz(uint32_t hz){
+  if(0 == hz){hz = HAL_HOST_REC_CLOCK_HZ;}
+  rec_byteNs = (uint32_t) (8000000000ULL / hz);
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_setResponder()
+********************************************************************************
+* \brief
+*   Set the model of the slaves while recording. Called once per byte with the
+*   slave ID and the byte sent, returns the byte clocked back. Without one
+*   MISO idles at HAL_HOST_REC_MISO_IDLE.
+*
+*******************************************************************************/
+void spi_hostRec_setResponder(uint8_t (*fn_exchange)(uint8_t id, uint8_t mosi)){
+  rec_fn_exchange = fn_exchange;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_startReplay()
+********************************************************************************
+* \brief
+*   Make the current recording the reference and start a new one. From now on
+*   MISO bytes come from the reference, in the order they were recorded.
+*
+*******************************************************************************/
+void spi_hostRec_startReplay(void){
+  rec_ref = rec_live;
+  spi_hostRec_reset();
+  rec_isReplaying = true;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_isReplaying()
+********************************************************************************
+* \brief
+*   Check if MISO bytes come from a reference recording
+*
+* \return
+*  True while replaying
+*******************************************************************************/
+bool spi_hostRec_isReplaying(void){
+  return rec_isReplaying;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_save()
+********************************************************************************
+* \brief
+*   Write the current recording to a file, to be replayed with
+*   spi_hostRec_load() by a later run on the same host
+*
+* \param path [in]
+*   File to create
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostRec_save(const char *path){
+  uint32_t error = 0;
+  FILE *file = (NULL == path) ? NULL : fopen(path, "wb");
+  if(NULL == file){error|=ERROR_UNAVAILABLE;}
+  if(!error){
+    bool isOk = (1 == fwrite(REC_FILE_MAGIC, sizeof(REC_FILE_MAGIC), 1, file));
+    isOk = isOk && (1 == fwrite(&rec_live.numEvents, sizeof(rec_live.numEvents), 1, file));
+    isOk = isOk && (1 == fwrite(&rec_live.numData, sizeof(rec_live.numData), 1, file));
+    isOk = isOk && (rec_live.numEvents == fwrite(rec_live.events, sizeof(HAL_HOST_REC_EVENT_S), rec_live.numEvents, file));
+    isOk = isOk && (rec_live.numData == fwrite(rec_live.mosi, 1, rec_live.numData, file));
+    isOk = isOk && (rec_live.numData == fwrite(rec_live.miso, 1, rec_live.numData, file));
+    if(0 != fclose(file)){isOk = false;}
+    if(!isOk){error|=ERROR_INVALID;}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_load()
+********************************************************************************
+* \brief
+*   Read a recording saved with spi_hostRec_save() as the reference, and start
+*   replaying it with an empty recording
+*
+* \param path [in]
+*   File to read
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostRec_load(const char *path){
+  uint32_t error = 0;
+  FILE *file = (NULL == path) ? NULL : fopen(path, "rb");
+  if(NULL == file){error|=ERROR_UNAVAILABLE;}
+  if(!error){
+    char magic[sizeof(REC_FILE_MAGIC)];
+    bool isOk = (1 == fread(magic, sizeof(magic), 1, file)) && (0 == memcmp(magic, REC_FILE_MAGIC, sizeof(magic)));
+    isOk = isOk && (1 == fread(&rec_ref.numEvents, sizeof(rec_ref.numEvents), 1, file));
+    isOk = isOk && (1 == fread(&rec_ref.numData, sizeof(rec_ref.numData), 1, file));
+    isOk = isOk && (rec_ref.numEvents <= HAL_HOST_REC_EVENT_MAX) && (rec_ref.numData <= HAL_HOST_REC_DATA_MAX);
+    isOk = isOk && (rec_ref.numEvents == fread(rec_ref.events, sizeof(HAL_HOST_REC_EVENT_S), rec_ref.numEvents, file));
+    isOk = isOk && (rec_ref.numData == fread(rec_ref.mosi, 1, rec_ref.numData, file));
+    isOk = isOk && (rec_ref.numData == fread(rec_ref.miso, 1, rec_ref.numData, file));
+    fclose(file);
+    if(!isOk){
+      rec_ref.numEvents = 0;
+      rec_ref.numData = 0;
+      error|=ERROR_INVALID;
+    }
+  }
+  if(!error){
+    spi_hostRec_reset();
+    rec_isReplaying = true;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_getNumEvents()
+********************************************************************************
+* \brief
+*   Number of events in the current recording
+*
+* \return
+*  Number of events
+*******************************************************************************/
+uint32_t spi_hostRec_getNumEvents(void){
+  return rec_live.numEvents;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_getEvent()
+********************************************************************************
+* \brief
+*   Access an event of the current recording
+*
+* \param idx [in]
+*   Event index, in the order logged
+*
+* \return
+*  Event, NULL if idx is out of range
+*******************************************************************************/
+const HAL_HOST_REC_EVENT_S *spi_hostRec_getEvent(uint32_t idx){
+  return (idx < rec_live.numEvents) ? &rec_live.events[idx] : NULL;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_getData()
+********************************************************************************
+* \brief
+*   Access the bytes of a WRITE, READ or EXCHANGE event
+*
+* \param event [in]
+*   Event of the current recording
+*
+* \param mosi [out]
+*   event->len bytes sent
+*
+* \param miso [out]
+*   event->len bytes received
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_hostRec_getData(const HAL_HOST_REC_EVENT_S *event, const uint8_t **mosi, const uint8_t **miso){
+  uint32_t error = 0;
+  if((NULL == event) || (NULL == mosi) || (NULL == miso)){error|=ERROR_POINTER;}
+  else if(event->type < HAL_HOST_REC_WRITE){error|=ERROR_MODE;}
+  if(!error){
+    *mosi = &rec_live.mosi[event->dataIdx];
+    *miso = &rec_live.miso[event->dataIdx];
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_getSummary()
+********************************************************************************
+* \brief
+*   Bus usage of one slave in the current recording
+*
+* \param id [in]
+*   Slave ID, HAL_HOST_REC_ID_ALL for all slaves
+*
+* \param summary [out]
+*   Bus usage
+*
+* \return
+*  Error code of the operation, ERROR_UNAVAILABLE if the recording is
+*  incomplete because the log filled
+*******************************************************************************/
+uint32_t spi_hostRec_getSummary(uint8_t id, HAL_HOST_REC_SUMMARY_S *const summary){
+  uint32_t error = 0;
+  if(NULL == summary){error|=ERROR_POINTER;}
+  if(!error){
+    bool isAll = (HAL_HOST_REC_ID_ALL == id);
+    memset(summary, 0, sizeof(*summary));
+    uint8_t dcLevel = 0xFF;
+    for(uint32_t i = 0; i < rec_live.numEvents; i++){
+      const HAL_HOST_REC_EVENT_S *event = &rec_live.events[i];
+      /* The D/C pin level is tracked across slaves, changes count for the slave selected */
+      bool isChange = (HAL_HOST_REC_DC == event->type) && (event->arg != dcLevel);
+      if(HAL_HOST_REC_DC == event->type){dcLevel = event->arg;}
+      if(!isAll && (event->id != id)){continue;}
+      if(isChange){summary->dcChanges++;}
+      switch(event->type){
+        case HAL_HOST_REC_CS_ASSERT: summary->transactions++; break;
+        case HAL_HOST_REC_SELECT: summary->selects++; break;
+        case HAL_HOST_REC_WRITE: summary->bytesWritten += event->len; break;
+        case HAL_HOST_REC_READ: summary->bytesRead += event->len; break;
+        case HAL_HOST_REC_EXCHANGE:
+          summary->bytesWritten += event->len;
+          summary->bytesRead += event->len;
+          break;
+        default: break;
+      }
+      if(event->type >= HAL_HOST_REC_WRITE){
+        summary->busUs += (uint32_t) (((uint64_t) event->len * rec_byteNs) / 1000);
+      }
+    }
+    for(uint16_t i = 0; i < 256; i++){
+      if(isAll || (i == id)){
+        summary->replayMismatch += rec_mismatch[i];
+        summary->replayUnderrun += rec_underrun[i];
+      }
+    }
+    if(rec_live.isFull){error|=ERROR_UNAVAILABLE;}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_getTimeUs()
+********************************************************************************
+* \brief
+*   Virtual time since the last reset
+*
+* \return
+*  Microseconds of bytes clocked and delays
+*******************************************************************************/
+uint32_t spi_hostRec_getTimeUs(void){
+  return (uint32_t) (rec_timeNs / 1000);
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_print()
+********************************************************************************
+* \brief
+*   Print the current recording, one event per line
+*
+* \param stream [in]
+*   Destination, e.g. stdout
+*
+*******************************************************************************/
+void spi_hostRec_print(FILE *stream){
+  static const char *names[] = {"SEL", "CS+", "CS-", "DC ", "RST", "DLY", "W  ", "R  ", "X  "};
+  for(uint32_t i = 0; i < rec_live.numEvents; i++){
+    const HAL_HOST_REC_EVENT_S *event = &rec_live.events[i];
+    fprintf(stream, "%10lu us  id %u  %s", (unsigned long) event->timeUs, event->id, names[event->type]);
+    if((HAL_HOST_REC_DC == event->type) || (HAL_HOST_REC_RESET == event->type)){
+      fprintf(stream, " %u", event->arg);
+    } else if(HAL_HOST_REC_DELAY == event->type){
+      fprintf(stream, " %u us", event->len);
+    } else if(event->type >= HAL_HOST_REC_WRITE){
+      /* MISO of reads, MOSI otherwise */
+      const uint8_t *data = (HAL_HOST_REC_READ == event->type) ? rec_live.miso : rec_live.mosi;
+      fprintf(stream, " %5u:", event->len);
+      for(uint16_t j = 0; (j < event->len) && (j < REC_HEX_PER_LINE); j++){
+        fprintf(stream, " %02X", data[event->dataIdx + j]);
+      }
+      if(event->len > REC_HEX_PER_LINE){fprintf(stream, " ...");}
+    }
+    fprintf(stream, "\n");
+  }
+  if(rec_live.isFull){fprintf(stream, "Recording incomplete, log full\n");}
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_printSummary()
+********************************************************************************
+* \brief
+*   Print the bus usage of every slave seen in the current recording
+*
+* \param stream [in]
+*   Destination, e.g. stdout
+*
+*******************************************************************************/
+void spi_hostRec_printSummary(FILE *stream){
+  bool isSeen[256] = {false};
+  for(uint32_t i = 0; i < rec_live.numEvents; i++){
+    isSeen[rec_live.events[i].id] = true;
+  }
+  fprintf(stream, "  id  trans    sel  written     read   dc   bus us  mismatch underrun\n");
+  HAL_HOST_REC_SUMMARY_S summary;
+  for(uint16_t id = 0; id <= 256; id++){
+    bool isTotal = (256 == id);
+    if(!isTotal && !isSeen[id]){continue;}
+    spi_hostRec_getSummary(isTotal ? HAL_HOST_REC_ID_ALL : (uint8_t) id, &summary);
+    if(isTotal){fprintf(stream, " all");} else {fprintf(stream, "%4u", id);}
+    fprintf(stream, " %6lu %6lu %8lu %8lu %4lu %8lu %9lu %8lu\n", (unsigned long) summary.transactions,
+      (unsigned long) summary.selects, (unsigned long) summary.bytesWritten, (unsigned long) summary.bytesRead,
+      (unsigned long) summary.dcChanges, (unsigned long) summary.busUs, (unsigned long) summary.replayMismatch,
+      (unsigned long) summary.replayUnderrun);
+  }
+  fprintf(stream, "Virtual time %lu us\n", (unsigned long) spi_hostRec_getTimeUs());
+}
+
+/* Responder installed on the simulated SCB, logs each byte shifted */
+static uint8_t spi_hostRec_wire(uint8_t id, uint8_t mosi){
+  return spi_hostRec_byte(id, HAL_HOST_REC_EXCHANGE, mosi);
+}
+
+/* Log the bytes of a driver tap, a NULL tx sends dummy bytes and a NULL rx discards */
+static void spi_hostRec_bytes(uint8_t id, const uint8_t *tx, uint8_t *rx, uint16_t len){
+  HAL_HOST_REC_TYPE_T type = HAL_HOST_REC_EXCHANGE;
+  if(NULL == rx){type = HAL_HOST_REC_WRITE;}
+  else if(NULL == tx){type = HAL_HOST_REC_READ;}
+  for(uint16_t i = 0; i < len; i++){
+    uint8_t miso = spi_hostRec_byte(id, type, (NULL == tx) ? 0 : tx[i]);
+    if(NULL != rx){rx[i] = miso;}
+  }
+}
+
+/*******************************************************************************
+* Function Name: spi_hostRec_byte()
+********************************************************************************
+* \brief
+*   Exchange and log one byte. Consecutive bytes of the same kind to the same
+*   slave extend one event.
+*
+* \return
+*  Byte received
+*******************************************************************************/
+static uint8_t spi_hostRec_byte(uint8_t id, HAL_HOST_REC_TYPE_T type, uint8_t mosi){
+  uint8_t miso = HAL_HOST_REC_MISO_IDLE;
+  if(rec_isReplaying){
+    if(rec_refIdx < rec_ref.numData){
+      if(rec_ref.mosi[rec_refIdx] != mosi){rec_mismatch[id]++;}
+      miso = rec_ref.miso[rec_refIdx];
+      rec_refIdx++;
+    } else {
+      rec_underrun[id]++;
+    }
+  } else if(NULL != rec_fn_exchange){
+    miso = rec_fn_exchange(id, mosi);
+  }
+  /* Log */
+  HAL_HOST_REC_EVENT_S *last = (0 == rec_live.numEvents) ? NULL : &rec_live.events[rec_live.numEvents - 1];
+  bool isExtend = (NULL != last) && (last->type == type) && (last->id == id) && (last->len < UINT16_MAX) &&
+    ((last->dataIdx + last->len) == rec_live.numData);
+  if(!isExtend){
+    spi_hostRec_event(type, id, 0, 0);
+    last = (0 == rec_live.numEvents) ? NULL : &rec_live.events[rec_live.numEvents - 1];
+  }
+  if(rec_live.isFull || (rec_live.numData >= HAL_HOST_REC_DATA_MAX) || (NULL == last) || (last->type != type)){
+    rec_live.isFull = true;
+  } else {
+    rec_live.mosi[rec_live.numData] = mosi;
+    rec_live.miso[rec_live.numData] = miso;
+    rec_live.numData++;
+    last->len++;
+  }
+  rec_timeNs += rec_byteNs;
+  return miso;
+}
+
+/* Append an event at the current virtual time */
+static void spi_hostRec_event(HAL_HOST_REC_TYPE_T type, uint8_t id, uint8_t arg, uint16_t len){
+  if(HAL_HOST_REC_CS_ASSERT == type){rec_csId = id;}
+  if(rec_live.isFull || (rec_live.numEvents >= HAL_HOST_REC_EVENT_MAX)){
+    rec_live.isFull = true;
+    return;
+  }
+  HAL_HOST_REC_EVENT_S *event = &rec_live.events[rec_live.numEvents++];
+  event->timeUs = (uint32_t) (rec_timeNs / 1000);
+  event->type = type;
+  event->id = id;
+  event->arg = arg;
+  event->len = len;
+  event->dataIdx = rec_live.numData;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,115 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: hal_hostRecorder.h
+* Workspace: MJL Hardware Abstraction Layer (HAL) Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: SPI bus recorder and replayer for host analysis. Logs every chip
+*   select, byte, D/C and reset pin change and delay with a virtual timestamp,
+*   and summarises bytes and transactions per device.
+*
+*   Two taps share one log
+*     - Driver function pointers (fn_spi_writeArrayBlocking, ...), pass the
+*       spi_hostRec_* functions in place of the HAL functions
+*     - MJL_SPI_S on the simulated SCB of hal_host, pass spi_hostRec_setActive,
+*       spi_hostRec_csAssert and spi_hostRec_csDeassert as hooks. Bytes are
+*       logged as they shift. Call spi_hostRec_reset() after spi_hostSCB_reset()
+*
+*   Replay feeds the MISO bytes of a recording back to the drivers in order,
+*   and counts the MOSI bytes that differ from the recording.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef HAL_HOST_RECORDER_H
+  #define HAL_HOST_RECORDER_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdint.h>
+  #include <stdbool.h>
+  #include <stdio.h>
+  #include "mjl_spi.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define HAL_HOST_REC_EVENT_MAX    (8192)    /* Events kept per log */
+  #define HAL_HOST_REC_DATA_MAX     (65536)   /* Bytes kept per log */
+  #define HAL_HOST_REC_ID_ALL       (0xFF)    /* Summary of all slaves */
+  #define HAL_HOST_REC_CLOCK_HZ     (1000000) /* Default virtual bus clock */
+  #define HAL_HOST_REC_MISO_IDLE    (0xFF)    /* MISO without a responder, or once a replay runs out */
+  /***************************************
+  * Enumerated types
+  ***************************************/
+  typedef enum {
+    HAL_HOST_REC_SELECT,        /* Active slave set, arg is unused */
+    HAL_HOST_REC_CS_ASSERT,
+    HAL_HOST_REC_CS_DEASSERT,
+    HAL_HOST_REC_DC,            /* D/C pin written, arg is the level */
+    HAL_HOST_REC_RESET,         /* Reset pin written, arg is the level */
+    HAL_HOST_REC_DELAY,         /* Delay, len is microseconds */
+    HAL_HOST_REC_WRITE,         /* len bytes sent, MISO ignored */
+    HAL_HOST_REC_READ,          /* len bytes received with dummy MOSI */
+    HAL_HOST_REC_EXCHANGE,      /* len bytes sent and received */
+  } HAL_HOST_REC_TYPE_T;
+
+  /***************************************
+  * Structures
+  ***************************************/
+  /* One logged bus event */
+  typedef struct {
+    uint32_t timeUs;            /* Virtual time at the start of the event */
+    HAL_HOST_REC_TYPE_T type;
+    uint8_t id;                 /* Slave ID */
+    uint8_t arg;                /* Pin level */
+    uint16_t len;               /* Bytes, or microseconds of a delay */
+    uint32_t dataIdx;           /* First byte in the MOSI/MISO logs */
+  } HAL_HOST_REC_EVENT_S;
+
+  /* Bus usage of one slave, or of all */
+  typedef struct {
+    uint32_t transactions;      /* Chip select assertions */
+    uint32_t selects;           /* Active slave changes through the MJL_SPI_S hook */
+    uint32_t bytesWritten;      /* Bytes with meaningful MOSI */
+    uint32_t bytesRead;         /* Bytes with meaningful MISO */
+    uint32_t dcChanges;         /* D/C pin writes */
+    uint32_t busUs;             /* Virtual time spent clocking bytes */
+    uint32_t replayMismatch;    /* MOSI bytes that differ from the replayed recording */
+    uint32_t replayUnderrun;    /* Bytes requested after the recording ran out */
+  } HAL_HOST_REC_SUMMARY_S;
+
+  /***************************************
+  * Function declarations
+  ***************************************/
+  /* Driver function pointer taps */
+  uint32_t spi_hostRec_writeArrayBlocking(uint8_t slaveId, const uint8_t *cmdArray, uint16_t len);
+  uint32_t spi_hostRec_readArrayBlocking(uint8_t slaveId, uint8_t *buffer, uint16_t len);
+  uint32_t spi_hostRec_transferSegments(uint8_t slaveId, const MJL_SPI_SEG_S *segs, uint8_t num);
+  void spi_hostRec_pinDataCommand(uint8_t val);
+  void spi_hostRec_pinReset(uint8_t val);
+  void spi_hostRec_delayUs(uint16_t microsecond);
+  /* MJL_SPI_S hooks, forwarded to hal_host */
+  uint32_t spi_hostRec_setActive(uint8_t id);
+  uint32_t spi_hostRec_csAssert(uint8_t id);
+  void spi_hostRec_csDeassert(void);
+  /* Control */
+  void spi_hostRec_reset(void);
+  void spi_hostRec_setClockHz(uint32_t hz);
+  void spi_hostRec_setResponder(uint8_t (*fn_exchange)(uint8_t id, uint8_t mosi));
+  void spi_hostRec_startReplay(void);
+  bool spi_hostRec_isReplaying(void);
+  uint32_t spi_hostRec_save(const char *path);
+  uint32_t spi_hostRec_load(const char *path);
+  /* Analysis */
+  uint32_t spi_hostRec_getNumEvents(void);
+  const HAL_HOST_REC_EVENT_S *spi_hostRec_getEvent(uint32_t idx);
+  uint32_t spi_hostRec_getData(const HAL_HOST_REC_EVENT_S *event, const uint8_t **mosi, const uint8_t **miso);
+  uint32_t spi_hostRec_getSummary(uint8_t id, HAL_HOST_REC_SUMMARY_S *const summary);
+  uint32_t spi_hostRec_getTimeUs(void);
+  void spi_hostRec_print(FILE *stream);
+  void spi_hostRec_printSummary(FILE *stream);
+
+#endif /* HAL_HOST_RECORDER_H */
+/* [] END OF FILE */
@@ -80,7 +80,110 @@ uint32_t uart_psoc4SCB_read(uint8_t *data){
     return error;
 }
 
+/*******************************************************************************
+* Function Name: uart_psoc4SCB_getTxFree()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC4
+*   Free space in the TX FIFO, for the MJL UART TX ring. Requires the component
+*   without a software TX buffer.
+*
+* \return
+*  Number of bytes that can be written without waiting
+*******************************************************************************/
+uint32_t uart_psoc4SCB_getTxFree(void){
+    uint32_t num = uartUsb_SpiUartGetTxBufferSize();
+    return (num < UART_SCB_FIFO_DEPTH) ? (UART_SCB_FIFO_DEPTH - num) : 0;
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc4SCB_setTxIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC4
+*   Enable or disable the TX FIFO not full interrupt that drains the MJL UART
+*   TX ring. The SCB interrupt handler calls uart_txIsr() followed by 
+*   uart_psoc4SCB_clearTxIrq()
+*
+* \param enable [in]
+*   True to enable the interrupt source
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc4SCB_setTxIrq(bool enable){
+    uint32_t error = 0;
+    uartUsb_SetTxInterruptMode(enable ? uartUsb_INTR_TX_NOT_FULL : 0u);
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc4SCB_clearTxIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC4
+*   Clear the TX FIFO not full interrupt after the TX ring has been drained
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc4SCB_clearTxIrq(void){
+    uint32_t error = 0;
+    uartUsb_ClearTxInterruptSource(uartUsb_INTR_TX_NOT_FULL);
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc4SCB_setRxIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC4
+*   Enable or disable the RX FIFO not empty interrupt that fills the MJL UART
+*   RX ring. The SCB interrupt handler calls uart_rxIsr() followed by 
+*   uart_psoc4SCB_clearRxIrq(). Requires the component without a software RX
+*   buffer.
+*
+* \param enable [in]
+*   True to enable the interrupt source
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc4SCB_setRxIrq(bool enable){
+    uint32_t error = 0;
+    uartUsb_SetRxInterruptMode(enable ? uartUsb_INTR_RX_NOT_EMPTY : 0u);
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc4SCB_clearRxIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC4
+*   Clear the RX FIFO not empty interrupt after the RX FIFO has been emptied
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc4SCB_clearRxIrq(void){
+    uint32_t error = 0;
+    uartUsb_ClearRxInterruptSource(uartUsb_INTR_RX_NOT_EMPTY);
+    return error;
+}
+
 #ifdef USE_SPI
+    /* Slave asserted by spi_assertSlave(), the only one released */
+    static uint8_t spi_activeSlave = SL_SPI_ID_DISPLAY;
+    /* Slave whose settings the SCB holds, none at reset */
+    static uint8_t spi_configuredSlave = SPI_NUM_SLAVES;
+
+    /* Bus settings of each slave, indexed by slave ID */
+    const MJL_SPI_DEVICE_S spi_devices[SPI_NUM_SLAVES] = {
+        [SL_SPI_ID_DISPLAY] = {.id = SL_SPI_ID_DISPLAY, .mode = MJL_SPI_MODE_0, .maxClockHz = SPI_CLK_HZ_DISPLAY, .csActiveHigh = (SPI_CS_ACTIVE != 0)},
+        [SL_SPI_ID_INA]     = {.id = SL_SPI_ID_INA,     .mode = MJL_SPI_MODE_0, .maxClockHz = SPI_CLK_HZ_INA,     .csActiveHigh = (SPI_CS_ACTIVE != 0)},
+        [SL_SPI_ID_FLASH]   = {.id = SL_SPI_ID_FLASH,   .mode = MJL_SPI_MODE_0, .maxClockHz = SPI_CLK_HZ_FLASH,   .csActiveHigh = (SPI_CS_ACTIVE != 0)},
+    };
+
     /*******************************************************************************
     * Function Name: spi_scbWriteArrayBlocking()
     ********************************************************************************
@@ -163,6 +266,62 @@ uint32_t uart_psoc4SCB_read(uint8_t *data){
         return error;
     }
 
+    /*******************************************************************************
+    * Function Name: spi_scbTransferSegments()
+    ********************************************************************************
+    * \brief
+    *   Run a list of segments (command, address, data, read...) with the chip 
+    *   select held for all of them. Each segment's fn_before hook runs once the 
+    *   previous segment has shifted. This is a blocking function.
+    *
+    * \param slaveId [in]
+    *   ID of the slave
+    *   
+    * \param segs [in/out]
+    *   Array of segments, exchanged in order
+    *
+    * \param num [in]
+    *   Number of segments
+    * 
+    * \return
+    *  Error code of the operation
+    *******************************************************************************/
+    uint32_t spi_scbTransferSegments(uint8_t slaveId, const MJL_SPI_SEG_S *segs, uint8_t num) {
+        uint32_t error = 0;
+        /* Bit bang CS line, held for every segment */
+        error |= spi_assertSlave(slaveId);
+        SPI_SpiUartClearRxBuffer();
+        for(uint8_t i = 0; (i < num) && !error; i++){
+            if(NULL != segs[i].fn_before){
+                segs[i].fn_before(segs[i].arg);
+            }
+            /* Exchange a FIFO at a time so the RX FIFO can not overflow */
+            uint16_t idx = 0;
+            while((idx < segs[i].len) && !error){
+                uint16_t chunk = segs[i].len - idx;
+                if(chunk > SPI_SCB_FIFO_DEPTH){chunk = SPI_SCB_FIFO_DEPTH;}
+                for(uint16_t j = 0; j < chunk; j++){
+                    SPI_SpiUartWriteTxData((NULL == segs[i].tx) ? 0 : segs[i].tx[idx + j]);
+                }
+                /* Wait until the chunk has been shifted in */
+                uint16_t count = 0;
+                while(SPI_SpiUartGetRxBufferSize() < chunk){
+                    if(++count == 0){
+                        error=ERROR_TIMEOUT;
+                        break;
+                    }
+                }
+                for(uint16_t j = 0; (j < chunk) && !error; j++){
+                    uint8_t data = (uint8_t) SPI_SpiUartReadRxData();
+                    if(NULL != segs[i].rx){segs[i].rx[idx + j] = data;}
+                }
+                idx += chunk;
+            }
+        }
+        /* Bit bang CS line */
+        spi_disassertSlave();
+        return error;
+    }
 
     /*******************************************************************************
     * Function Name: spi_assertSlave()
@@ -175,6 +334,11 @@ uint32_t uart_psoc4SCB_read(uint8_t *data){
     *******************************************************************************/
     uint32_t spi_assertSlave(uint8_t slaveId){
         uint32_t error = 0;
+        /* Switch the clock and mode only when the slave changes */
+        if((slaveId < SPI_NUM_SLAVES) && (slaveId != spi_configuredSlave)){
+            error |= spi_psoc4SCB_configure(&spi_devices[slaveId]);
+            spi_configuredSlave = slaveId;
+        }
         /* OLED Display */
         if(slaveId == SL_SPI_ID_DISPLAY){
             pin_SPI_CS_DISP_Write(SPI_CS_ACTIVE);   
@@ -191,6 +355,39 @@ uint32_t uart_psoc4SCB_read(uint8_t *data){
         else{
             error |= ERROR_SHIFT_VAL;   
         }
+        if(!error){spi_activeSlave = slaveId;}
+        return error;
+    }
+
+    /*******************************************************************************
+    * Function Name: spi_psoc4SCB_configure()
+    ********************************************************************************
+    * \brief
+    *  Apply the clock and mode of a device. The SCB clock divider is chosen so
+    *  the bit rate does not exceed maxClockHz, limited by the SCB itself. Chip
+    *  selects are bit banged with SPI_CS_ACTIVE.
+    *
+    * \param device [in]
+    *  Descriptor of the device about to be selected
+    *
+    * \return
+    *  Error code of the operation
+    *******************************************************************************/
+    uint32_t spi_psoc4SCB_configure(const MJL_SPI_DEVICE_S *device){
+        uint32_t error = 0;
+        /* Bit rate is HFCLK / (divider * oversample) */
+        uint32_t bitRateMax = device->maxClockHz * SPI_SPI_OVS_FACTOR;
+        uint32_t divider = (CYDEV_BCLK__HFCLK__HZ + bitRateMax - 1) / bitRateMax;
+        if(0 == divider){divider = 1;}
+        /* Clock polarity and phase */
+        static const uint32_t sclkMode[] = {
+            0, SPI_SPI_CTRL_CPHA, SPI_SPI_CTRL_CPOL, (SPI_SPI_CTRL_CPHA | SPI_SPI_CTRL_CPOL)
+        };
+        /* The block must be disabled to change its settings */
+        SPI_Stop();
+        SPI_SCBCLK_SetDividerValue((uint16) divider);
+        SPI_SPI_CTRL_REG = (SPI_SPI_CTRL_REG & ~(SPI_SPI_CTRL_CPHA | SPI_SPI_CTRL_CPOL)) | sclkMode[device->mode];
+        SPI_Enable();
         return error;
     }
 
@@ -198,15 +395,22 @@ uint32_t uart_psoc4SCB_read(uint8_t *data){
     * Function Name: spi_disassertSlave()
     ********************************************************************************
     * \brief
-    *  Bit banged - Remove the active slave
+    *  Bit banged - Remove the active slave. Only the pin asserted by 
+    *  spi_assertSlave() is written
     *
     * \return
     *  None
     *******************************************************************************/
     void spi_disassertSlave(void){
-        pin_SPI_CS_DISP_Write(SPI_CS_INACTIVE);
-        pin_SPI_CS_INA_Write(SPI_CS_INACTIVE);
-        pin_SPI_CS_FLASH_Write(SPI_CS_INACTIVE);
+        if(spi_activeSlave == SL_SPI_ID_DISPLAY){
+            pin_SPI_CS_DISP_Write(SPI_CS_INACTIVE);
+        }
+        else if (spi_activeSlave == SL_SPI_ID_INA) {
+            pin_SPI_CS_INA_Write(SPI_CS_INACTIVE);
+        }
+        else {
+            pin_SPI_CS_FLASH_Write(SPI_CS_INACTIVE);
+        }
     }
 #endif /* USE_SPI */
 
@@ -222,3 +426,29 @@ uint32_t uart_psoc4SCB_read(uint8_t *data){
 void pin_oled_reset_write_dummy(uint8_t val){
     (void) val;
 }
+
+/*******************************************************************************
+* Function Name: critical_psoc4_enter()
+********************************************************************************
+* \brief
+*   Enter a critical section by disabling interrupts
+*
+* \return
+*  Previous interrupt state, pass to critical_psoc4_exit()
+*******************************************************************************/
+uint32_t critical_psoc4_enter(void){
+    return (uint32_t) CyEnterCriticalSection();
+}
+
+/*******************************************************************************
+* Function Name: critical_psoc4_exit()
+********************************************************************************
+* \brief
+*   Leave a critical section by restoring the interrupt state
+*
+* \return
+*  None
+*******************************************************************************/
+void critical_psoc4_exit(uint32_t intState){
+    CyExitCriticalSection((uint8_t) intState);
+}
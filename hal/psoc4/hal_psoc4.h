@@ -39,6 +39,7 @@
   #define BATT_MON_RL         (5100.0) /* Low side battery monitor resistor */
   #define BATT_MON_SCALE      ((BATT_MON_RH + BATT_MON_RL) / (BATT_MON_RL)) /* Scaling factor for the battery */
   #define LEN_ROW 128
+  #define UART_SCB_FIFO_DEPTH (8) /* Bytes in the SCB TX FIFO of the UART */
   
   #ifdef USE_SPI
     #define SL_SPI_ID_DISPLAY   (0) /* SPI Slave ID of the Display */
@@ -46,6 +47,11 @@
     #define SL_SPI_ID_FLASH     (2) /* SPI Slave ID of the Flash */
     #define SPI_CS_ACTIVE       (0) /* Value to assert an active slave) */
     #define SPI_CS_INACTIVE     (1) /* Value to disassert a slave) */
+    #define SPI_SCB_FIFO_DEPTH  (8) /* Bytes in the SCB RX/TX FIFO */
+    #define SPI_NUM_SLAVES      (3) /* Number of slaves on the bus */
+    #define SPI_CLK_HZ_DISPLAY  (10000000) /* Maximum clock of the SSD1306 */
+    #define SPI_CLK_HZ_INA      (1000000)  /* Clock of the Instrumentation Amp */
+    #define SPI_CLK_HZ_FLASH    (50000000) /* Maximum clock of the IS25LP for normal reads */
   #endif /* USE_SPI */
 
   /***************************************
@@ -58,6 +64,7 @@
   extern MLJ_UART_S usb;
   #ifdef USE_SPI
     extern MJL_SPI_S spi;
+    extern const MJL_SPI_DEVICE_S spi_devices[SPI_NUM_SLAVES];
   #endif /* USE_SPI*/
 
   /***************************************
@@ -67,16 +74,26 @@
   uint32_t uart_psoc4SCB_stop(MLJ_UART_T *const state);
   uint32_t uart_psoc4SCB_writeArrayBlocking(const uint8_t *array, uint16_t len);
   uint32_t uart_psoc4SCB_read(uint8_t *data);
+  uint32_t uart_psoc4SCB_getTxFree(void);
+  uint32_t uart_psoc4SCB_setTxIrq(bool enable);
+  uint32_t uart_psoc4SCB_clearTxIrq(void);
+  uint32_t uart_psoc4SCB_setRxIrq(bool enable);
+  uint32_t uart_psoc4SCB_clearRxIrq(void);
 
   #ifdef USE_SPI
     uint32_t spi_scbWriteArrayBlocking(uint8_t slaveId, uint8_t * cmdArray, uint16_t len);
     uint32_t spi_scbReadArrayBlocking(uint8_t slaveId, uint8_t * buffer, uint16_t len);
+    uint32_t spi_scbTransferSegments(uint8_t slaveId, const MJL_SPI_SEG_S *segs, uint8_t num);
     uint32_t spi_assertSlave(uint8_t slaveId);
+    uint32_t spi_psoc4SCB_configure(const MJL_SPI_DEVICE_S *device);
     void spi_disassertSlave(void);
   #endif /* USE_SPI */
 
   void pin_oled_reset_write_dummy(uint8_t val);
 
+  uint32_t critical_psoc4_enter(void);
+  void critical_psoc4_exit(uint32_t intState);
+
     
 #endif /* HAL_PSOC4_H */
 /* [] END OF FILE */
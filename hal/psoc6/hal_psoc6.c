@@ -14,6 +14,22 @@
 #include "mjl_errors.h"
 #include "project.h"    /* Cypress files*/
 
+#ifdef USE_SPI_DMA
+  /* Descriptor being moved, in pieces of at most one X loop */
+  static MJL_DMA_DESC_S *spi_dmaDesc = NULL;
+  static uint16_t spi_dmaIdx = 0;
+  static uint16_t spi_dmaNum = 0;
+  static const uint8_t spi_dmaDummy = MJL_DMA_DUMMY_BYTE;
+  static uint8_t spi_dmaDiscard;
+  static void spi_psoc6SCB_dmaNext(void);
+#endif /* USE_SPI_DMA */
+#ifdef USE_UART_DMA
+  static MJL_DMA_DESC_S *uart_dmaDesc = NULL;
+  static uint16_t uart_dmaIdx = 0;
+  static uint16_t uart_dmaNum = 0;
+  static void uart_psoc6SCB_dmaNext(void);
+#endif /* USE_UART_DMA */
+
 /*******************************************************************************
 * Function Name: uart_psoc6SCB_start()
 ********************************************************************************
@@ -27,6 +43,13 @@ uint32_t uart_psoc6SCB_start(MLJ_UART_T *const state){
     uint32_t error = 0;   
     (void) state;
     uartUsb_Start();
+    #ifdef USE_UART_DMA
+      /* Memory to TX FIFO, completion interrupt calls uart_psoc6SCB_dmaIsr() */
+      uartDma_Init();
+      Cy_DMA_Descriptor_SetDstAddress(&uartDma_Descriptor_1, (void *) &uartUsb_HW->TX_FIFO_WR);
+      Cy_DMA_Channel_SetInterruptMask(uartDma_HW, uartDma_DW_CHANNEL, CY_DMA_INTR_MASK);
+      Cy_DMA_Enable(uartDma_HW);
+    #endif /* USE_UART_DMA */
     return error;
 }
 
@@ -79,6 +102,157 @@ uint32_t uart_psoc6SCB_read(uint8_t *data){
   return error;
 }
 
+/*******************************************************************************
+* Function Name: uart_psoc6SCB_getTxFree()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC6
+*   Free space in the TX FIFO, for the MJL UART TX ring
+*
+* \return
+*  Number of bytes that can be written without waiting
+*******************************************************************************/
+uint32_t uart_psoc6SCB_getTxFree(void){
+  return Cy_SCB_GetFifoSize(uartUsb_HW) - Cy_SCB_UART_GetNumInTxFifo(uartUsb_HW);
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc6SCB_setTxIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC6
+*   Enable or disable the TX FIFO not full interrupt that drains the MJL UART
+*   TX ring. The SCB interrupt handler calls uart_txIsr() followed by 
+*   uart_psoc6SCB_clearTxIrq()
+*
+* \param enable [in]
+*   True to enable the interrupt source
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc6SCB_setTxIrq(bool enable){
+  uint32_t error = 0;
+  Cy_SCB_SetTxInterruptMask(uartUsb_HW, enable ? CY_SCB_UART_TX_NOT_FULL : 0UL);
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc6SCB_clearTxIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC6
+*   Clear the TX FIFO not full interrupt after the TX ring has been drained
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc6SCB_clearTxIrq(void){
+  uint32_t error = 0;
+  Cy_SCB_ClearTxInterrupt(uartUsb_HW, CY_SCB_UART_TX_NOT_FULL);
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc6SCB_setRxIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC6
+*   Enable or disable the RX FIFO not empty interrupt that fills the MJL UART
+*   RX ring. The SCB interrupt handler calls uart_rxIsr() followed by 
+*   uart_psoc6SCB_clearRxIrq()
+*
+* \param enable [in]
+*   True to enable the interrupt source
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc6SCB_setRxIrq(bool enable){
+  uint32_t error = 0;
+  Cy_SCB_SetRxInterruptMask(uartUsb_HW, enable ? CY_SCB_UART_RX_NOT_EMPTY : 0UL);
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc6SCB_clearRxIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC6
+*   Clear the RX FIFO not empty interrupt after the RX FIFO has been emptied
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc6SCB_clearRxIrq(void){
+  uint32_t error = 0;
+  Cy_SCB_ClearRxInterrupt(uartUsb_HW, CY_SCB_UART_RX_NOT_EMPTY);
+  return error;
+}
+
+#ifdef USE_UART_DMA
+/*******************************************************************************
+* Function Name: uart_psoc6SCB_dmaStart()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC6
+*   Write desc->tx to the TX FIFO with the uartDma channel. Transfers longer
+*   than one X loop are moved in pieces from uart_psoc6SCB_dmaIsr()
+*
+* \param desc [in/out]
+*   Descriptor of the transfer
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_psoc6SCB_dmaStart(MJL_DMA_DESC_S *const desc){
+  uint32_t error = 0;
+  if(NULL != uart_dmaDesc){error|=ERROR_RUNNING;}
+  if(!error){
+    uart_dmaDesc = desc;
+    uart_dmaIdx = 0;
+    uart_psoc6SCB_dmaNext();
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_psoc6SCB_dmaIsr()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based UART on PSoC6
+*   Interrupt handler of the uartDma channel. Starts the next piece of the 
+*   descriptor or hands it back through mjl_dma_complete()
+*
+*******************************************************************************/
+void uart_psoc6SCB_dmaIsr(void){
+  uint32_t error = 0;
+  if(CY_DMA_INTR_CAUSE_COMPLETION != Cy_DMA_Channel_GetStatus(uartDma_HW, uartDma_DW_CHANNEL)){error|=ERROR_INVALID;}
+  Cy_DMA_Channel_ClearInterrupt(uartDma_HW, uartDma_DW_CHANNEL);
+  MJL_DMA_DESC_S *desc = uart_dmaDesc;
+  if(NULL != desc){
+    uart_dmaIdx += uart_dmaNum;
+    if(!error && (uart_dmaIdx < desc->len)){
+      uart_psoc6SCB_dmaNext();
+    } else {
+      uart_dmaDesc = NULL;
+      mjl_dma_complete(desc, error);
+    }
+  }
+}
+
+/* Program and enable the channel for the next piece of the descriptor */
+static void uart_psoc6SCB_dmaNext(void){
+  uint16_t num = uart_dmaDesc->len - uart_dmaIdx;
+  if(num > CY_DMA_LOOP_COUNT_MAX){num = CY_DMA_LOOP_COUNT_MAX;}
+  uart_dmaNum = num;
+  Cy_DMA_Descriptor_SetSrcAddress(&uartDma_Descriptor_1, &uart_dmaDesc->tx[uart_dmaIdx]);
+  Cy_DMA_Descriptor_SetXloopDataCount(&uartDma_Descriptor_1, num);
+  Cy_DMA_Channel_SetDescriptor(uartDma_HW, uartDma_DW_CHANNEL, &uartDma_Descriptor_1);
+  Cy_DMA_Channel_Enable(uartDma_HW, uartDma_DW_CHANNEL);
+}
+#endif /* USE_UART_DMA */
+
 
 
 /*******************************************************************************
@@ -95,6 +269,16 @@ uint32_t spi_psoc6SCB_start(MJL_SPI_T *const state){
   uint32_t error = 0;
   (void) state;
   SPI_Start();
+  #ifdef USE_SPI_DMA
+    /* Memory to TX FIFO and RX FIFO to memory, the RX completion interrupt calls spi_psoc6SCB_dmaIsr() */
+    txDma_Init();
+    rxDma_Init();
+    Cy_DMA_Descriptor_SetDstAddress(&txDma_Descriptor_1, (void *) &SPI_HW->TX_FIFO_WR);
+    Cy_DMA_Descriptor_SetSrcAddress(&rxDma_Descriptor_1, (void *) &SPI_HW->RX_FIFO_RD);
+    Cy_DMA_Channel_SetInterruptMask(rxDma_HW, rxDma_DW_CHANNEL, CY_DMA_INTR_MASK);
+    Cy_DMA_Enable(txDma_HW);
+    Cy_DMA_Enable(rxDma_HW);
+  #endif /* USE_SPI_DMA */
   return error;
 }
 
@@ -150,6 +334,22 @@ uint32_t spi_psoc6SCB_read(uint8_t *result) {
   return error;
 }
 
+/*******************************************************************************
+* Function Name: spi_psoc6SCB_readArray()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based SPI on PSoC6
+*   Move len elements from the RX FIFO into the results buffer 
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_psoc6SCB_readArray(uint8_t *result, uint16_t len) {
+  uint32_t error = 0;
+  if(Cy_SCB_SPI_ReadArray(SPI_HW, result, len) != len){error|=ERROR_UNAVAILABLE;}
+  return error;
+}
+
 /*******************************************************************************
 * Function Name: spi_psoc6SCB_setActive()
 ********************************************************************************
@@ -227,8 +427,207 @@ uint32_t spi_psoc6SCB_clearTxBuffer(void) {
   return error;
 }
 
+/*******************************************************************************
+* Function Name: spi_psoc6SCB_setIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based SPI on PSoC6
+*   Enable or disable the RX FIFO not-empty interrupt that drives the MJL SPI
+*   transaction queue. The SCB interrupt handler calls spi_serviceQueue() 
+*   followed by spi_psoc6SCB_clearIrq()
+*
+* \param enable [in]
+*   True to enable the interrupt source
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_psoc6SCB_setIrq(bool enable){
+  uint32_t error = 0;
+  Cy_SCB_SetRxInterruptMask(SPI_HW, enable ? CY_SCB_RX_INTR_NOT_EMPTY : 0UL);
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_psoc6SCB_clearIrq()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based SPI on PSoC6
+*   Clear the RX FIFO not-empty interrupt after the queue has been serviced
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_psoc6SCB_clearIrq(void){
+  uint32_t error = 0;
+  Cy_SCB_ClearRxInterrupt(SPI_HW, CY_SCB_RX_INTR_NOT_EMPTY);
+  return error;
+}
+
 
 
+/*******************************************************************************
+* Function Name: spi_psoc6SCB_configure()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based SPI on PSoC6
+*   Apply the clock, mode and slave select polarity of a device. The SCB 
+*   clock divider is chosen so the bit rate does not exceed maxClockHz.
+*   Called by the MJL SPI driver only when the active device changes.
+*
+* \param device [in]
+*   Descriptor of the device about to be selected
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_psoc6SCB_configure(const MJL_SPI_DEVICE_S *device){
+  uint32_t error = 0;
+  /* Bit rate is clk_peri / (divider * oversample) */
+  uint32_t bitRateMax = device->maxClockHz * SPI_config.oversample;
+  uint32_t divider = (Cy_SysClk_ClkPeriGetFrequency() + bitRateMax - 1) / bitRateMax;
+  if(0 == divider){divider = 1;}
+  /* Clock polarity and phase */
+  static const cy_en_scb_spi_sclk_mode_t sclkMode[] = {
+    CY_SCB_SPI_CPHA0_CPOL0, CY_SCB_SPI_CPHA1_CPOL0, CY_SCB_SPI_CPHA0_CPOL1, CY_SCB_SPI_CPHA1_CPOL1
+  };
+  /* The block must be disabled to change its settings */
+  Cy_SCB_SPI_Disable(SPI_HW, &SPI_context);
+  SPI_SCBCLK_SetDivider(divider - 1);
+  SCB_SPI_CTRL(SPI_HW) = (SCB_SPI_CTRL(SPI_HW) & ~CY_SCB_SPI_CTRL_CLK_MODE_Msk) | _VAL2FLD(CY_SCB_SPI_CTRL_CLK_MODE, sclkMode[device->mode]);
+  Cy_SCB_SPI_SetSlaveSelectPolarity(SPI_HW, (cy_en_scb_spi_slave_select_t) device->id, 
+    device->csActiveHigh ? CY_SCB_SPI_ACTIVE_HIGH : CY_SCB_SPI_ACTIVE_LOW);
+  Cy_SCB_SPI_Enable(SPI_HW);
+  return error;
+}
+
+#ifdef USE_SPI_DMA
+/*******************************************************************************
+* Function Name: spi_psoc6SCB_dmaStart()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based SPI on PSoC6
+*   Exchange a descriptor with the txDma and rxDma channels. A NULL tx sends 
+*   the dummy byte and a NULL rx discards, both by not incrementing the 
+*   address. Transfers longer than one X loop are moved in pieces from 
+*   spi_psoc6SCB_dmaIsr()
+*
+* \param desc [in/out]
+*   Descriptor of the transfer
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_psoc6SCB_dmaStart(MJL_DMA_DESC_S *const desc){
+  uint32_t error = 0;
+  if(NULL != spi_dmaDesc){error|=ERROR_RUNNING;}
+  if(!error){
+    spi_dmaDesc = desc;
+    spi_dmaIdx = 0;
+    spi_psoc6SCB_dmaNext();
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_psoc6SCB_dmaAbort()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based SPI on PSoC6
+*   Stop both channels without completing the descriptor
+*
+*******************************************************************************/
+void spi_psoc6SCB_dmaAbort(void){
+  Cy_DMA_Channel_Disable(txDma_HW, txDma_DW_CHANNEL);
+  Cy_DMA_Channel_Disable(rxDma_HW, rxDma_DW_CHANNEL);
+  Cy_DMA_Channel_ClearInterrupt(rxDma_HW, rxDma_DW_CHANNEL);
+  spi_dmaDesc = NULL;
+}
+
+/*******************************************************************************
+* Function Name: spi_psoc6SCB_dmaIsr()
+********************************************************************************
+* \brief
+*   Wrapper for an SCB Based SPI on PSoC6
+*   Interrupt handler of the rxDma channel, all bytes of the piece have been
+*   received. Starts the next piece of the descriptor or hands it back 
+*   through mjl_dma_complete()
+*
+*******************************************************************************/
+void spi_psoc6SCB_dmaIsr(void){
+  uint32_t error = 0;
+  if(CY_DMA_INTR_CAUSE_COMPLETION != Cy_DMA_Channel_GetStatus(rxDma_HW, rxDma_DW_CHANNEL)){error|=ERROR_INVALID;}
+  Cy_DMA_Channel_ClearInterrupt(rxDma_HW, rxDma_DW_CHANNEL);
+  MJL_DMA_DESC_S *desc = spi_dmaDesc;
+  if(NULL != desc){
+    spi_dmaIdx += spi_dmaNum;
+    if(!error && (spi_dmaIdx < desc->len)){
+      spi_psoc6SCB_dmaNext();
+    } else {
+      spi_dmaDesc = NULL;
+      mjl_dma_complete(desc, error);
+    }
+  }
+}
+
+/* Program and enable both channels for the next piece of the descriptor */
+static void spi_psoc6SCB_dmaNext(void){
+  MJL_DMA_DESC_S *desc = spi_dmaDesc;
+  uint16_t num = desc->len - spi_dmaIdx;
+  if(num > CY_DMA_LOOP_COUNT_MAX){num = CY_DMA_LOOP_COUNT_MAX;}
+  spi_dmaNum = num;
+  /* Memory to TX FIFO */
+  if(NULL == desc->tx){
+    Cy_DMA_Descriptor_SetSrcAddress(&txDma_Descriptor_1, &spi_dmaDummy);
+    Cy_DMA_Descriptor_SetXloopSrcIncrement(&txDma_Descriptor_1, 0);
+  } else {
+    Cy_DMA_Descriptor_SetSrcAddress(&txDma_Descriptor_1, &desc->tx[spi_dmaIdx]);
+    Cy_DMA_Descriptor_SetXloopSrcIncrement(&txDma_Descriptor_1, 1);
+  }
+  Cy_DMA_Descriptor_SetXloopDataCount(&txDma_Descriptor_1, num);
+  /* RX FIFO to memory */
+  if(NULL == desc->rx){
+    Cy_DMA_Descriptor_SetDstAddress(&rxDma_Descriptor_1, &spi_dmaDiscard);
+    Cy_DMA_Descriptor_SetXloopDstIncrement(&rxDma_Descriptor_1, 0);
+  } else {
+    Cy_DMA_Descriptor_SetDstAddress(&rxDma_Descriptor_1, &desc->rx[spi_dmaIdx]);
+    Cy_DMA_Descriptor_SetXloopDstIncrement(&rxDma_Descriptor_1, 1);
+  }
+  Cy_DMA_Descriptor_SetXloopDataCount(&rxDma_Descriptor_1, num);
+  Cy_DMA_Channel_SetDescriptor(txDma_HW, txDma_DW_CHANNEL, &txDma_Descriptor_1);
+  Cy_DMA_Channel_SetDescriptor(rxDma_HW, rxDma_DW_CHANNEL, &rxDma_Descriptor_1);
+  /* Receiver first, so no byte is missed */
+  Cy_DMA_Channel_Enable(rxDma_HW, rxDma_DW_CHANNEL);
+  Cy_DMA_Channel_Enable(txDma_HW, txDma_DW_CHANNEL);
+}
+#endif /* USE_SPI_DMA */
+
+/*******************************************************************************
+* Function Name: critical_psoc6_enter()
+********************************************************************************
+* \brief
+*   Enter a critical section by disabling interrupts
+*
+* \return
+*  Previous interrupt state, pass to critical_psoc6_exit()
+*******************************************************************************/
+uint32_t critical_psoc6_enter(void){
+  return Cy_SysLib_EnterCriticalSection();
+}
+
+/*******************************************************************************
+* Function Name: critical_psoc6_exit()
+********************************************************************************
+* \brief
+*   Leave a critical section by restoring the interrupt state
+*
+* \return
+*  None
+*******************************************************************************/
+void critical_psoc6_exit(uint32_t intState){
+  Cy_SysLib_ExitCriticalSection(intState);
+}
+
 /*******************************************************************************
 * Function Name: spi_scbWriteArrayBlocking()
 ********************************************************************************
@@ -13,12 +13,21 @@
 /* Header Guard */
 #ifndef HAL_PSOC6_H
   #define HAL_PSOC6_H
+
+  /***************************************
+  * Configurations
+  ***************************************/
+  // #define USE_SPI_DMA   /* Uncomment when the design has txDma and rxDma components on the SPI DMA triggers */
+  // #define USE_UART_DMA  /* Uncomment when the design has a uartDma component on the uartUsb TX DMA trigger */
+
   /***************************************
   * Included files
   ***************************************/
   #include <stdint.h>
+  #include <stdbool.h>
   #include "mjl_uart.h"
   #include "mjl_spi.h"
+  #include "mjl_dma.h"
   /***************************************
   * Macro Definitions
   ***************************************/
@@ -39,16 +48,37 @@
   uint32_t uart_psoc6SCB_stop(MLJ_UART_T *const state);
   uint32_t uart_psoc6SCB_writeArrayBlocking(const uint8_t *array, uint16_t len);
   uint32_t uart_psoc6SCB_read(uint8_t *data);
+  uint32_t uart_psoc6SCB_getTxFree(void);
+  uint32_t uart_psoc6SCB_setTxIrq(bool enable);
+  uint32_t uart_psoc6SCB_clearTxIrq(void);
+  uint32_t uart_psoc6SCB_setRxIrq(bool enable);
+  uint32_t uart_psoc6SCB_clearRxIrq(void);
+  #ifdef USE_UART_DMA
+    uint32_t uart_psoc6SCB_dmaStart(MJL_DMA_DESC_S *const desc);
+    void uart_psoc6SCB_dmaIsr(void);
+  #endif /* USE_UART_DMA */
 
   uint32_t spi_psoc6SCB_start(MJL_SPI_T *const state);
   uint32_t spi_psoc6SCB_stop(MJL_SPI_T *const state);
   uint32_t spi_psoc6SCB_writeArray_blocking(const uint8_t *array, uint16_t len);
   uint32_t spi_psoc6SCB_read(uint8_t *result);
+  uint32_t spi_psoc6SCB_readArray(uint8_t *result, uint16_t len);
   uint32_t spi_psoc6SCB_setActive(uint8_t id);
   uint32_t spi_psoc6SCB_getRxBufferNum(void);
   uint32_t spi_psoc6SCB_getTxBufferNum(void);
   uint32_t spi_psoc6SCB_clearRxBuffer(void);
   uint32_t spi_psoc6SCB_clearTxBuffer(void);
+  uint32_t spi_psoc6SCB_setIrq(bool enable);
+  uint32_t spi_psoc6SCB_clearIrq(void);
+  uint32_t spi_psoc6SCB_configure(const MJL_SPI_DEVICE_S *device);
+  #ifdef USE_SPI_DMA
+    uint32_t spi_psoc6SCB_dmaStart(MJL_DMA_DESC_S *const desc);
+    void spi_psoc6SCB_dmaAbort(void);
+    void spi_psoc6SCB_dmaIsr(void);
+  #endif /* USE_SPI_DMA */
+
+  uint32_t critical_psoc6_enter(void);
+  void critical_psoc6_exit(uint32_t intState);
     
 #endif /* HAL_PSOC6_H */
 /* [] END OF FILE */
@@ -17,6 +17,7 @@
   ***************************************/
   #include <stdbool.h>
   #include <mjl_errors.h>
+  #include "mjl_spi.h"
   /***************************************
   * Macro Definitions
   ***************************************/
@@ -32,6 +33,7 @@
   #define IS25_RDMDID_LEN       (6) /* Length of the Read ID command  */
   #define IS25_RDMDID_POS_MFG   (4) /* Position of the manufacturer ID */   
   #define IS25_RDMDID_POS_DEV   (5) /* Position of the device ID */   
+  #define IS25_RDMDID_LEN_CMD   (4) /* Command and address bytes of the Read ID command */
 
   #define IS25_ID_MFG           (0x9D)  /* Manufacturer ID */
   #define IS25_ID_DEV           (0x14)  /* Device ID */
@@ -48,6 +50,7 @@
     void (*fn_delayUs)(uint16_t microsecond);
     uint32_t (*fn_spi_writeArrayBlocking) (uint8_t slaveId, const uint8_t * cmdArray, uint16_t len);
     uint32_t (*fn_spi_readArrayBlocking) (uint8_t slaveId, uint8_t * buffer, uint16_t len);
+    uint32_t (*fn_spi_transferSegments) (uint8_t slaveId, const MJL_SPI_SEG_S *segs, uint8_t num); /* Optional, command and data under one chip select */
     uint8_t slaveId;
 
   } FLASH_IS25_CFG_S;
@@ -57,6 +60,7 @@
     void (*fn_delayUs)(uint16_t microsecond);
     uint32_t (*fn_spi_writeArrayBlocking) (uint8_t slaveId, const uint8_t * cmdArray, uint16_t len);
     uint32_t (*fn_spi_readArrayBlocking) (uint8_t slaveId, uint8_t * buffer, uint16_t len);
+    uint32_t (*fn_spi_transferSegments) (uint8_t slaveId, const MJL_SPI_SEG_S *segs, uint8_t num);
     uint8_t slaveId;
 
 
@@ -22,6 +22,8 @@
   #include <stdbool.h>
   #include <stddef.h>
   #include "mjl_ringBuffer.h"
+  #include "mjl_ringTyped.h"
+  #include "mjl_spi.h"
   /***************************************
   * Macro Definitions
   ***************************************/
@@ -182,6 +184,7 @@
     void (*fn_pin_reset_write) (uint8_t val);
     void (*fn_pin_dataCommand_write) (uint8_t val);
     void (*fn_delayUs)(uint16_t microsecond);
+    uint32_t (*fn_spi_transferSegments) (uint8_t slaveId, const MJL_SPI_SEG_S *segs, uint8_t num); /* Optional, window and data under one chip select */
     display_window_s fullWindow;
     uint8_t spi_slaveId;
     /* Object function pointer */
@@ -200,6 +203,7 @@
     void (*fn_pin_reset_write) (uint8_t val);
     void (*fn_pin_dataCommand_write) (uint8_t val);
     void (*fn_delayUs)(uint16_t microsecond);
+    uint32_t (*fn_spi_transferSegments) (uint8_t slaveId, const MJL_SPI_SEG_S *segs, uint8_t num);
     display_window_s fullWindow;
     uint8_t spi_slaveId;
     /* Nested objects */
@@ -228,6 +232,7 @@
   uint32_t SSD1306_writeCommandArray(ssd1306_state_s *const state, uint8_t * cmdArray, uint8_t len);
   uint32_t SSD1306_writeDataArray(ssd1306_state_s *const state, const uint8_t * dataArray, uint16_t len);
   uint32_t SSD1306_setWindow(ssd1306_state_s *const state, display_window_s *const window);
+  uint32_t SSD1306_writeWindowData(ssd1306_state_s *const state, display_window_s *const window, const uint8_t * dataArray, uint16_t len);
   uint32_t SSD1306_setAddressingMode(ssd1306_state_s *const state, ssd1306_addressing_mode_t mode);
   uint32_t SSD1306_clearScreen(ssd1306_state_s *const state);
   uint32_t SSD1306_drawDigit_8x16(ssd1306_state_s *const state, uint8_t num);
@@ -250,6 +255,7 @@
   uint32_t display_graph_init(display_graph_s *const state, display_graph_cfg_s *const cfg);
   uint32_t display_updateGraphColumn(ssd1306_state_s *const state, display_graph_s *const graph, uint8_t colIdx, uint8_t val);
   uint32_t display_updateGraphScroll(ssd1306_state_s *const state, display_graph_s *const graph, mjl_ring_s *const ring);
+  uint32_t display_updateGraphScroll_u8(ssd1306_state_s *const state, display_graph_s *const graph, mjl_ring_u8_s *const ring);
   uint32_t display_line_init(display_line_s *const state, display_line_cfg_s *const cfg);
 
 
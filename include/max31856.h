@@ -51,6 +51,8 @@
 
   /* SPI */
   #define MAX31856_MASK_WRITEADDR            (0x80)     /* Mask for writing to addresses */
+  #define MAX31856_SPI_MODE               (MJL_SPI_MODE_1)  /* Data is sampled on the falling edge (modes 1 and 3) */
+  #define MAX31856_SPI_CLOCK_MAX_HZ       (5000000)  /* Maximum serial clock */
   /* Configuration Register 0 (CR0) */
   #define MAX31856_CR0_ADDR               (0x00)     /* Address of Configuration 0 Register */
   #define MAX31856_CR0_VAL                (0x00)     /* Default value of Configuration 0 Register */
@@ -129,6 +131,7 @@
     uint32_t error;     /* Passing error codes out */
     uint8_t slaveId;    /* ID of the slave */    
     MJL_SPI_S* spi;    /* SPI comms struct */
+    MJL_SPI_DEVICE_S spiDevice; /* Bus settings registered with the SPI */
     float temp;         /* latest temperature reading */
   } max31856_state_s;
   
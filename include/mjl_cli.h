@@ -0,0 +1,104 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_cli.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Command line over a uart. mjl_cli_process() moves the bytes received
+*   by the uart RX ring into the line buffer, edits the line in place and, at
+*   the end of a line, splits it in place into arguments and calls the
+*   handler of the matching command of a const table. Arguments point into
+*   the line buffer, nothing is copied. Returns at once when nothing has been
+*   received, so it can run from the main loop or from opt_fn_rxReceived
+*   signalling the main loop.
+*
+*   Arguments are separated by spaces or tabs, "double quotes" keep spaces.
+*   Backspace removes the last character, lines longer than the line buffer
+*   are rejected.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_CLI_H
+  #define MJL_CLI_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <stdint.h>
+  #include <mjl_errors.h>
+  #include "mjl_uart.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #ifndef MJL_CLI_ARGS_MAX
+    #define MJL_CLI_ARGS_MAX    (8)     /* Arguments of a line, command included */
+  #endif
+  #define MJL_CLI_PROMPT        "> "    /* Default prompt */
+
+  /***************************************
+  * Enumerated types
+  ***************************************/
+
+  /***************************************
+  * Structures
+  ***************************************/
+  /* Forward declare struct */
+  typedef struct MJL_CLI_S MJL_CLI_T;
+  /* Command handler, argv[0] is the command, argv[argc] is NULL */
+  typedef uint32_t (*MJL_CLI_FN_T)(MJL_CLI_T *const cli, uint8_t argc, char *argv[]);
+  /* Entry of the command table */
+  typedef struct {
+    const char *name;                 /* Command typed, case sensitive */
+    MJL_CLI_FN_T fn;                  /* Handler */
+    const char *help;                 /* One line description, listed by mjl_cli_help() */
+  } MJL_CLI_CMD_S;
+
+  /* Configuration Structure */
+  typedef struct {
+    MLJ_UART_S *uart;                 /* Initialized uart, with an RX ring for interrupt driven input */
+    const MJL_CLI_CMD_S *cmds;        /* Command table */
+    uint8_t numCmds;                  /* Entries of cmds */
+    char *lineBuffer;                 /* Line storage, edited and split in place */
+    uint16_t lineBufferLen;           /* Bytes of lineBuffer, longest line plus one */
+    bool opt_echo;                    /* Echo typed characters back */
+    const char *opt_prompt;           /* Printed before every line, NULL for MJL_CLI_PROMPT */
+    void *opt_ctx;                    /* Optional, for the handlers */
+  } MJL_CLI_CFG_S;
+
+  /* CLI State Object */
+  typedef struct MJL_CLI_S {
+    MLJ_UART_S *uart;
+    const MJL_CLI_CMD_S *cmds;
+    uint8_t numCmds;
+    char *lineBuffer;
+    uint16_t lineBufferLen;
+    bool echo;
+    const char *prompt;
+    void *ctx;
+    char *argv[MJL_CLI_ARGS_MAX + 1]; /* Arguments of the line being executed */
+    uint8_t argc;
+    uint16_t _lineLen;                /* Characters of the line being typed */
+    bool _isOverflow;                 /* Line being typed did not fit, rejected at its end */
+    bool _isCr;                       /* Last character ended a line with CR, skip a following LF */
+    bool _isPromptDue;
+    uint32_t lastError;               /* Error of the last line */
+    uint32_t linesRun;                /* Lines handed to a handler */
+    uint32_t linesRejected;           /* Unknown, too long or too many arguments */
+    bool _init;
+  } MJL_CLI_S;
+
+  /* Default config struct */
+  extern const MJL_CLI_CFG_S mjl_cli_cfg_default;
+  /***************************************
+  * Function declarations
+  ***************************************/
+  uint32_t mjl_cli_init(MJL_CLI_S *const cli, MJL_CLI_CFG_S *const cfg);
+  uint32_t mjl_cli_process(MJL_CLI_S *const cli);
+  uint32_t mjl_cli_execute(MJL_CLI_S *const cli, char *line);
+  /* Handler listing the command table, add it as e.g. {"help", mjl_cli_help, "List commands"} */
+  uint32_t mjl_cli_help(MJL_CLI_T *const cli, uint8_t argc, char *argv[]);
+
+#endif /* MJL_CLI_H */
+/* [] END OF FILE */
@@ -0,0 +1,75 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_dma.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Descriptor contract between the MJL middleware and DMA capable HALs.
+*   The middleware fills a descriptor and passes it to the HAL start hook
+*   (opt_hal_dmaStart for SPI, hal_opt_dmaStart for UART). The HAL moves the
+*   data without the CPU and calls mjl_dma_complete() from its DMA interrupt
+*   when the last byte has been received (SPI) or written to the FIFO (UART).
+*   The descriptor must stay valid until then.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_DMA_H
+  #define MJL_DMA_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <stdint.h>
+  #include <mjl_errors.h>
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define MJL_DMA_DUMMY_BYTE    (0)   /* Sent by the HAL when the descriptor has no tx data */
+
+  /***************************************
+  * Structures
+  ***************************************/
+  /* One DMA transfer between memory and a peripheral FIFO */
+  typedef struct MJL_DMA_DESC_S {
+    const uint8_t *tx;                            /* Data to send, NULL sends MJL_DMA_DUMMY_BYTE */
+    uint8_t *rx;                                  /* Received data, NULL discards it. Unused for UART */
+    uint16_t len;                                 /* Number of bytes */
+    void (*fn_complete)(struct MJL_DMA_DESC_S *const desc, uint32_t error);  /* Optional, called from the DMA interrupt */
+    void *context;                                /* User data for the completion callback */
+    /* Private */
+    volatile bool _busy;
+  } MJL_DMA_DESC_S;
+
+  /***************************************
+  * Function declarations
+  ***************************************/
+  /*******************************************************************************
+  * Function Name: mjl_dma_complete()
+  ********************************************************************************
+  * \brief
+  *   Completion hook, called by the HAL once the transfer of a descriptor has
+  *   finished or failed. Releases the descriptor before the callback so the
+  *   callback can start the next transfer with it.
+  *
+  * \param desc [in/out]
+  * Descriptor passed to the start hook
+  *
+  * \param error [in]
+  * Error code of the transfer
+  *******************************************************************************/
+  static inline void mjl_dma_complete(MJL_DMA_DESC_S *const desc, uint32_t error){
+    desc->_busy = false;
+    if(NULL != desc->fn_complete){
+      desc->fn_complete(desc, error);
+    }
+  }
+
+  /* True while the HAL owns the descriptor */
+  static inline bool mjl_dma_isBusy(const MJL_DMA_DESC_S *const desc){
+    return desc->_busy;
+  }
+
+#endif /* MJL_DMA_H */
+/* [] END OF FILE */
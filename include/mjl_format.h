@@ -0,0 +1,48 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_format.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Number to ASCII conversion without division or floating point
+*   arithmetic, for cores without an FPU or a hardware divider (Cortex-M0/M0+).
+*   Decimal digits are produced two at a time from a table, dividing by 100
+*   with a reciprocal multiply. Fractions are formatted in fixed point, doubles
+*   are decomposed from their IEEE-754 bits.
+*
+*   Output is written forward into the caller's buffer and is not zero
+*   terminated. Fractions are rounded to nearest, ties to even.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_FORMAT_H
+  #define MJL_FORMAT_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <stdint.h>
+  #include <mjl_errors.h>
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define FORMAT_PREC_MAX     (9u)            /* Most digits after the decimal point */
+  #define FORMAT_FLOAT_MAX    (1000000000u)   /* Largest magnitude of format_double() */
+  #define FORMAT_U32_LEN      (10u)           /* Buffer bytes for format_u32() */
+  #define FORMAT_I32_LEN      (11u)           /* Buffer bytes for format_i32() */
+  #define FORMAT_HEX32_LEN    (8u)            /* Buffer bytes for format_hex32() */
+  #define FORMAT_FIXED_LEN    (1u + FORMAT_U32_LEN + 1u + FORMAT_PREC_MAX) /* Buffer bytes for format_fixed() and format_double() */
+
+  /***************************************
+  * Function declarations
+  ***************************************/
+  uint32_t format_u32(uint32_t val, uint8_t *buf, uint8_t *len);
+  uint32_t format_i32(int32_t val, uint8_t *buf, uint8_t *len);
+  uint32_t format_hex32(uint32_t val, uint8_t *buf, uint8_t *len);
+  uint32_t format_fixed(int32_t val, uint8_t fracBits, uint8_t prec, uint8_t *buf, uint8_t *len);
+  uint32_t format_double(double val, uint8_t prec, uint8_t *buf, uint8_t *len);
+
+#endif /* MJL_FORMAT_H */
+/* [] END OF FILE */
@@ -0,0 +1,118 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_log.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Deferred binary logging. MJL_LOG() keeps its format string in the
+*   mjl_log section of the ELF and writes only the offset of the string and
+*   the raw arguments out of the uart. tools/mjl_log_decode.py rebuilds the
+*   text on the host from the ELF, with the conversions of uart_printf().
+*
+*   Arguments are sent as 32 bit words, at most MJL_LOG_ARGS_MAX per call
+*     - Integers and bool are cast to uint32_t, wider integers are truncated
+*     - float and double are sent as float
+*     - char and void pointers are sent as their address. %s is decoded only
+*       for strings held in the ELF, such as string literals
+*
+*   The firmware only takes the address of the strings, the linker script can
+*   place the mjl_log section as (INFO) to keep them out of flash. Offsets are
+*   16 bit, a string past the first 64 KiB of the section is not logged and
+*   MJL_LOG() returns ERROR_PARAM.
+*
+*   Frame, little endian
+*     MJL_LOG_SYNC or MJL_LOG_SYNC_TICKS
+*     uint16_t offset of the format string in the mjl_log section
+*     uint32_t ticks of opt_getTicks, MJL_LOG_SYNC_TICKS only
+*     uint32_t argument, one per conversion in the format string
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_LOG_H
+  #define MJL_LOG_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <stdint.h>
+  #include <string.h>
+  #include <mjl_errors.h>
+  #include "mjl_uart.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define MJL_LOG_SYNC          (0xA6)  /* First byte of a frame */
+  #define MJL_LOG_SYNC_TICKS    (0xA7)  /* First byte of a frame with a timestamp */
+  #define MJL_LOG_ARGS_MAX      (8)     /* Arguments of one MJL_LOG() call */
+  #define MJL_LOG_FRAME_MAX     (1 + 2 + 4 + (4 * MJL_LOG_ARGS_MAX))
+
+  /* Log fmt and its arguments to an initialized MJL_LOG_S, evaluates to the error code */
+  #define MJL_LOG(log, fmt, ...) ({ \
+    static const char _mjlLogFmt[] __attribute__((section("mjl_log"), used)) = fmt; \
+    const uint32_t _mjlLogArgs[] = { MJL_LOG_MAP(__VA_ARGS__) 0 }; \
+    mjl_log_write((log), _mjlLogFmt, _mjlLogArgs, MJL_LOG_NARG(__VA_ARGS__)); \
+  })
+
+  /* Argument to a 32 bit word */
+  #define MJL_LOG_ARG(x) _Generic((x), \
+    float: mjl_log_argFloat, \
+    double: mjl_log_argFloat, \
+    char*: mjl_log_argPointer, \
+    const char*: mjl_log_argPointer, \
+    void*: mjl_log_argPointer, \
+    const void*: mjl_log_argPointer, \
+    default: mjl_log_argInt)(x)
+
+  /* Count and map up to MJL_LOG_ARGS_MAX arguments */
+  #define MJL_LOG_NARG(...) MJL_LOG_NARG_(_, ##__VA_ARGS__, 8, 7, 6, 5, 4, 3, 2, 1, 0)
+  #define MJL_LOG_NARG_(_0, _1, _2, _3, _4, _5, _6, _7, _8, n, ...) n
+  #define MJL_LOG_MAP(...) MJL_LOG_MAP_N(MJL_LOG_NARG(__VA_ARGS__), ##__VA_ARGS__)
+  #define MJL_LOG_MAP_N(n, ...) MJL_LOG_MAP_CAT(MJL_LOG_MAP_, n)(__VA_ARGS__)
+  #define MJL_LOG_MAP_CAT(a, b) a##b
+  #define MJL_LOG_MAP_0(...)
+  #define MJL_LOG_MAP_1(x)      MJL_LOG_ARG(x),
+  #define MJL_LOG_MAP_2(x, ...) MJL_LOG_ARG(x), MJL_LOG_MAP_1(__VA_ARGS__)
+  #define MJL_LOG_MAP_3(x, ...) MJL_LOG_ARG(x), MJL_LOG_MAP_2(__VA_ARGS__)
+  #define MJL_LOG_MAP_4(x, ...) MJL_LOG_ARG(x), MJL_LOG_MAP_3(__VA_ARGS__)
+  #define MJL_LOG_MAP_5(x, ...) MJL_LOG_ARG(x), MJL_LOG_MAP_4(__VA_ARGS__)
+  #define MJL_LOG_MAP_6(x, ...) MJL_LOG_ARG(x), MJL_LOG_MAP_5(__VA_ARGS__)
+  #define MJL_LOG_MAP_7(x, ...) MJL_LOG_ARG(x), MJL_LOG_MAP_6(__VA_ARGS__)
+  #define MJL_LOG_MAP_8(x, ...) MJL_LOG_ARG(x), MJL_LOG_MAP_7(__VA_ARGS__)
+
+  /***************************************
+  * Structures
+  ***************************************/
+  /* Configuration Structure */
+  typedef struct {
+    MLJ_UART_S *uart;                 /* Initialized uart the frames are written to */
+    uint32_t (*opt_getTicks)(void);   /* Optional, timestamp each frame */
+  } MJL_LOG_CFG_S;
+
+  /* Log State Object */
+  typedef struct {
+    MLJ_UART_S *uart;
+    uint32_t (*opt_getTicks)(void);
+    uint32_t framesDropped;           /* Frames the uart did not accept */
+    bool _init;
+  } MJL_LOG_S;
+
+  /* Default config struct */
+  extern const MJL_LOG_CFG_S mjl_log_cfg_default;
+  /***************************************
+  * Function declarations
+  ***************************************/
+  uint32_t mjl_log_init(MJL_LOG_S *const state, MJL_LOG_CFG_S *const cfg);
+  uint32_t mjl_log_write(MJL_LOG_S *const state, const char *fmt, const uint32_t *args, uint8_t num);
+
+  static inline uint32_t mjl_log_argInt(uint32_t val){return val;}
+  static inline uint32_t mjl_log_argPointer(const void *ptr){return (uint32_t) (uintptr_t) ptr;}
+  static inline uint32_t mjl_log_argFloat(float val){
+    uint32_t bits;
+    memcpy(&bits, &val, sizeof(bits));
+    return bits;
+  }
+
+#endif /* MJL_LOG_H */
+/* [] END OF FILE */
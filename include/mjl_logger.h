@@ -0,0 +1,124 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_logger.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Leveled logging front end. MJL_LOGE(), MJL_LOGW(), MJL_LOGI() and
+*   MJL_LOGD() above the level of the module expand to nothing, so the call,
+*   its arguments and its strings are removed from the binary. Enabled calls
+*   are formatted like uart_printf() and handed to the sink set with
+*   mjl_logger_setSink(): a uart, a RAM ring or an application function such
+*   as a flash log.
+*
+*   Levels are set when compiling
+*     - MJL_LOGGER_LEVEL, for the whole build, e.g. -DMJL_LOGGER_LEVEL=1
+*     - MJL_LOGGER_MODULE_LEVEL, defined in a .c file before this header is
+*       included, for that file only
+*     - MJL_LOGGER_LEVEL_MAX, caps both, MJL_LOGGER_LEVEL_NONE removes every
+*       call for a release build
+*
+*   With MJL_LOGGER_DEFERRED defined the enabled calls use MJL_LOG() of
+*   mjl_log.h instead, through the log set with mjl_logger_setDeferred().
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_LOGGER_H
+  #define MJL_LOGGER_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <stdint.h>
+  #include <stdarg.h>
+  #include <mjl_errors.h>
+  #include "mjl_uart.h"
+  #include "mjl_log.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define MJL_LOGGER_LEVEL_NONE     (0)
+  #define MJL_LOGGER_LEVEL_ERROR    (1)
+  #define MJL_LOGGER_LEVEL_WARN     (2)
+  #define MJL_LOGGER_LEVEL_INFO     (3)
+  #define MJL_LOGGER_LEVEL_DEBUG    (4)
+  #ifndef MJL_LOGGER_LEVEL
+    #define MJL_LOGGER_LEVEL        MJL_LOGGER_LEVEL_INFO   /* Level of modules that do not set one */
+  #endif
+  #ifndef MJL_LOGGER_LEVEL_MAX
+    #define MJL_LOGGER_LEVEL_MAX    MJL_LOGGER_LEVEL_DEBUG  /* Cap of every module */
+  #endif
+  #ifndef MJL_LOGGER_LINE_LEN
+    #define MJL_LOGGER_LINE_LEN     UART_PRINTF_BUFFER_LEN  /* Stack buffer of mjl_logger_sinkUart(), bytes per uart write */
+  #endif
+
+  /***************************************
+  * Enumerated types
+  ***************************************/
+
+  /***************************************
+  * Structures
+  ***************************************/
+  /* Receives every enabled call, returns the error code of the write */
+  typedef uint32_t (*MJL_LOGGER_SINK_T)(void *ctx, uint8_t level, const char *fmt, va_list args);
+
+  /***************************************
+  * Function declarations
+  ***************************************/
+  void mjl_logger_setSink(MJL_LOGGER_SINK_T sink, void *ctx);
+  void mjl_logger_setDeferred(MJL_LOG_S *log);
+  uint32_t mjl_logger_write(uint8_t level, const char *fmt, ...);
+  /* Sinks, ctx is an MLJ_UART_S or an initialized mjl_ring_u8_s */
+  uint32_t mjl_logger_sinkUart(void *ctx, uint8_t level, const char *fmt, va_list args);
+  uint32_t mjl_logger_sinkRing(void *ctx, uint8_t level, const char *fmt, va_list args);
+
+  extern MJL_LOG_S *mjl_logger_deferred;
+
+  #ifdef MJL_LOGGER_DEFERRED
+    #define MJL_LOGGER_EMIT(level, fmt, ...) do{ \
+      if(NULL != mjl_logger_deferred){(void) MJL_LOG(mjl_logger_deferred, fmt, ##__VA_ARGS__);} \
+    } while(0)
+  #else
+    #define MJL_LOGGER_EMIT(level, fmt, ...) do{ \
+      (void) mjl_logger_write((level), fmt, ##__VA_ARGS__); \
+    } while(0)
+  #endif
+
+#endif /* MJL_LOGGER_H */
+
+/***************************************
+* Level of the including file, evaluated on every include
+***************************************/
+#ifdef MJL_LOGGER_MODULE_LEVEL
+  #define MJL_LOGGER_ACTIVE_LEVEL MJL_LOGGER_MODULE_LEVEL
+#else
+  #define MJL_LOGGER_ACTIVE_LEVEL MJL_LOGGER_LEVEL
+#endif
+#undef MJL_LOGE
+#undef MJL_LOGW
+#undef MJL_LOGI
+#undef MJL_LOGD
+#if (MJL_LOGGER_ACTIVE_LEVEL >= MJL_LOGGER_LEVEL_ERROR) && (MJL_LOGGER_LEVEL_MAX >= MJL_LOGGER_LEVEL_ERROR)
+  #define MJL_LOGE(fmt, ...) MJL_LOGGER_EMIT(MJL_LOGGER_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+  #define MJL_LOGE(fmt, ...) do{ } while(0)
+#endif
+#if (MJL_LOGGER_ACTIVE_LEVEL >= MJL_LOGGER_LEVEL_WARN) && (MJL_LOGGER_LEVEL_MAX >= MJL_LOGGER_LEVEL_WARN)
+  #define MJL_LOGW(fmt, ...) MJL_LOGGER_EMIT(MJL_LOGGER_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+  #define MJL_LOGW(fmt, ...) do{ } while(0)
+#endif
+#if (MJL_LOGGER_ACTIVE_LEVEL >= MJL_LOGGER_LEVEL_INFO) && (MJL_LOGGER_LEVEL_MAX >= MJL_LOGGER_LEVEL_INFO)
+  #define MJL_LOGI(fmt, ...) MJL_LOGGER_EMIT(MJL_LOGGER_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+  #define MJL_LOGI(fmt, ...) do{ } while(0)
+#endif
+#if (MJL_LOGGER_ACTIVE_LEVEL >= MJL_LOGGER_LEVEL_DEBUG) && (MJL_LOGGER_LEVEL_MAX >= MJL_LOGGER_LEVEL_DEBUG)
+  #define MJL_LOGD(fmt, ...) MJL_LOGGER_EMIT(MJL_LOGGER_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+  #define MJL_LOGD(fmt, ...) do{ } while(0)
+#endif
+#undef MJL_LOGGER_ACTIVE_LEVEL
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_metrics.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Runtime counters and gauges updated by the drivers on their hot
+*   paths, to see where bus time goes on a running device. Build with
+*   MJL_METRICS_ENABLE defined (make METRICS=1) to include them, otherwise
+*   the update macros expand to nothing and the registry is removed.
+*
+*   Each metric is a uint32_t that wraps. Updates are plain read modify
+*   writes, an interrupt updating the same metric as the main loop can lose
+*   a count.
+*
+*   mjl_metrics_dump() frame, little endian
+*     MJL_METRICS_SYNC_0, MJL_METRICS_SYNC_1, MJL_METRICS_VERSION, count
+*     count x uint32_t value, in MJL_METRIC_ID_T order
+*     checksum, 8 bit sum of every previous byte of the frame
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_METRICS_H
+  #define MJL_METRICS_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <stdint.h>
+  #include <mjl_errors.h>
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define MJL_METRICS_SYNC_0    (0xA5)  /* First byte of a dump frame */
+  #define MJL_METRICS_SYNC_1    (0x4D)  /* Second byte of a dump frame, 'M' */
+  #define MJL_METRICS_VERSION   (1)     /* Incremented when the IDs change */
+  #ifndef MJL_METRICS_APP_NUM
+    #define MJL_METRICS_APP_NUM (4)     /* Metrics reserved for the application */
+  #endif
+  /***************************************
+  * Enumerated types
+  ***************************************/
+  typedef enum {
+    MJL_METRIC_SPI_BYTES,         /* Counter, bytes exchanged by the CPU or DMA */
+    MJL_METRIC_SPI_TRANSACTIONS,  /* Counter, slave selections, one per queued chunk */
+    MJL_METRIC_SPI_SPINS,         /* Counter, blocking exchange polls that moved no data */
+    MJL_METRIC_SPI_DMA_BYTES,     /* Counter, bytes handed to the DMA */
+    MJL_METRIC_SPI_WAIT_MAX,      /* Gauge, longest queue wait in ticks of opt_hal_getTicks */
+    MJL_METRIC_UART_BYTES,        /* Counter, bytes written, directly or through the TX ring */
+    MJL_METRIC_UART_WRITES,       /* Counter, writes of formatted output or arrays */
+    MJL_METRIC_RING_OVERWRITES,   /* Counter, elements lost by rings in overwrite mode */
+    MJL_METRIC_DISPLAY_BYTES,     /* Counter, pixel data bytes sent to displays */
+    MJL_METRIC_APP_0,             /* First application metric */
+    MJL_METRIC_NUM = MJL_METRIC_APP_0 + MJL_METRICS_APP_NUM,
+  } MJL_METRIC_ID_T;
+
+  /***************************************
+  * Structures
+  ***************************************/
+  /* Declared in mjl_uart.h, which includes this header through mjl_ringTyped.h */
+  struct MLJ_UART_S;
+
+  /***************************************
+  * Update macros
+  ***************************************/
+  #ifdef MJL_METRICS_ENABLE
+    extern volatile uint32_t mjl_metrics[MJL_METRIC_NUM];
+    #define MJL_METRIC_ADD(id, n)   do{ mjl_metrics[(id)] += (uint32_t) (n); } while(0)
+    #define MJL_METRIC_INC(id)      MJL_METRIC_ADD((id), 1)
+    #define MJL_METRIC_SET(id, val) do{ mjl_metrics[(id)] = (uint32_t) (val); } while(0)
+    #define MJL_METRIC_MAX(id, val) do{ if((uint32_t) (val) > mjl_metrics[(id)]){mjl_metrics[(id)] = (uint32_t) (val);} } while(0)
+  #else
+    #define MJL_METRIC_ADD(id, n)   do{ } while(0)
+    #define MJL_METRIC_INC(id)      do{ } while(0)
+    #define MJL_METRIC_SET(id, val) do{ } while(0)
+    #define MJL_METRIC_MAX(id, val) do{ } while(0)
+  #endif
+
+  /***************************************
+  * Function declarations
+  ***************************************/
+  #ifdef MJL_METRICS_ENABLE
+    uint32_t mjl_metrics_get(MJL_METRIC_ID_T id, uint32_t *value);
+    void mjl_metrics_reset(void);
+    uint32_t mjl_metrics_dump(struct MLJ_UART_S *const uart);
+  #else
+    /* Calls compile either way, without the registry they report it missing */
+    static inline uint32_t mjl_metrics_get(MJL_METRIC_ID_T id, uint32_t *value){(void) id; (void) value; return ERROR_UNAVAILABLE;}
+    static inline void mjl_metrics_reset(void){}
+    static inline uint32_t mjl_metrics_dump(struct MLJ_UART_S *const uart){(void) uart; return ERROR_UNAVAILABLE;}
+  #endif
+
+#endif /* MJL_METRICS_H */
+/* [] END OF FILE */
@@ -0,0 +1,48 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_parse.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: ASCII to number conversion without division or floating point
+*   arithmetic, the counterpart of mjl_format.h for input received by the
+*   uart, e.g. the arguments of an mjl_cli command. Fractions are converted to
+*   binary a bit at a time by doubling and comparing, floats are assembled
+*   from their IEEE-754 bits with a table of powers of ten.
+*
+*   The whole buffer must be the number, without spaces, and need not be
+*   terminated. Every parser returns
+*     - ERROR_UNAVAILABLE for an empty buffer
+*     - ERROR_VAL for anything else than a number
+*     - ERROR_INVALID for a number out of range of the result
+*   and leaves the result unchanged on error.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_PARSE_H
+  #define MJL_PARSE_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <stdint.h>
+  #include <mjl_errors.h>
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define PARSE_FRAC_DIGITS   (9u)    /* Fraction digits of parse_fixed() used exactly, later ones only round */
+  #define PARSE_MANT_DIGITS   (19u)   /* Significant digits of parse_float() used exactly, later ones only round */
+
+  /***************************************
+  * Function declarations
+  ***************************************/
+  uint32_t parse_u32(const uint8_t *buf, uint16_t len, uint32_t *result);
+  uint32_t parse_i32(const uint8_t *buf, uint16_t len, int32_t *result);
+  uint32_t parse_hex32(const uint8_t *buf, uint16_t len, uint32_t *result);
+  uint32_t parse_fixed(const uint8_t *buf, uint16_t len, uint8_t fracBits, int32_t *result);
+  uint32_t parse_float(const uint8_t *buf, uint16_t len, float *result);
+
+#endif /* MJL_PARSE_H */
+/* [] END OF FILE */
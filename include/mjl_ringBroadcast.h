@@ -0,0 +1,69 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringBroadcast.h
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Single producer ring read by any number of independent readers. The
+*   producer never blocks; each reader carries its own sequence number and 
+*   skips ahead, counting the lost elements, when it has been overrun.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_RING_BROADCAST_H
+  #define MJL_RING_BROADCAST_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <mjl_errors.h>
+  #include "mjl_ringBuffer.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+
+  /***************************************
+  * Enumerated types
+  ***************************************/
+
+  /***************************************
+  * Structures 
+  ***************************************/
+  /* Configuration Structure */
+  typedef struct {
+    uint32_t *buffer;
+    uint16_t size;      /* Must be a power of two, one slot is kept for the producer */
+  } mjl_ringBroadcast_cfg_s;
+
+  /* Broadcast State Object */
+  typedef struct {
+    uint32_t *buffer;
+    uint16_t mask;
+    volatile uint32_t head;   /* Sequence number of the next element */
+    bool _init;
+  } mjl_ringBroadcast_s;
+
+  /* Reader cursor */
+  typedef struct {
+    uint32_t seq;       /* Sequence number of the next element to read */
+    uint32_t lost;      /* Total elements overwritten before they were read */
+    bool _init;
+  } mjl_ringBroadcast_reader_s;
+
+  /* Default config struct */
+  extern const mjl_ringBroadcast_cfg_s mjl_ringBroadcast_cfg_default;
+  /***************************************
+  * Function declarations 
+  ***************************************/
+  /* State Operations */
+  uint32_t mjl_ringBroadcast_init(mjl_ringBroadcast_s *const state, mjl_ringBroadcast_cfg_s *const cfg);
+  uint32_t mjl_ringBroadcast_enqueue(mjl_ringBroadcast_s *const state, uint32_t in);
+  /* Reader Operations */
+  uint32_t mjl_ringBroadcast_attach(mjl_ringBroadcast_s *const state, mjl_ringBroadcast_reader_s *const reader, bool fromOldest);
+  uint32_t mjl_ringBroadcast_read(mjl_ringBroadcast_s *const state, mjl_ringBroadcast_reader_s *const reader, uint32_t *out);
+  uint16_t mjl_ringBroadcast_getAvailable(mjl_ringBroadcast_s *const state, mjl_ringBroadcast_reader_s *const reader);
+
+#endif /* MJL_RING_BROADCAST_H */
+/* [] END OF FILE */
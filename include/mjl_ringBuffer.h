@@ -20,7 +20,18 @@
   /***************************************
   * Macro Definitions
   ***************************************/
-
+  #define MJL_RING_SPSC_SIZE_MAX    (0x7FFF) /* Largest SPSC ring, indices run over twice the size */
+  #define MJL_RING_POW2_SIZE_MAX    (0x8000) /* Largest power of two ring, indices are free running */
+  #define MJL_RING_IS_POW2(n)       (((n) != 0) && (0 == ((n) & ((n) - 1)))) /* Is n a power of two */
+  /* Compile time check of a power of two ring size, place next to the buffer declaration */
+  #define MJL_RING_POW2_ASSERT_SIZE(n) \
+    _Static_assert(MJL_RING_IS_POW2(n) && ((n) <= MJL_RING_POW2_SIZE_MAX), "Ring size must be a power of two")
+  /* Data memory barrier - Orders buffer accesses against index updates */
+  #if defined(__arm__)
+    #define MJL_RING_DMB()          __asm volatile ("dmb" ::: "memory")
+  #else
+    #define MJL_RING_DMB()          __sync_synchronize()
+  #endif
   /***************************************
   * Enumerated types
   ***************************************/
@@ -47,6 +58,35 @@
     bool _init;
   } mjl_ring_s;
 
+  /* Contiguous region of ring storage */
+  typedef struct {
+    uint32_t *data;
+    uint16_t len;
+  } mjl_ring_span_s;
+
+  /* Single Producer/Single Consumer State Object
+  * Only the producer writes head and only the consumer writes tail. Both 
+  * indices run over [0, 2*size) so a full buffer can be told from an empty one
+  * without a shared count */
+  typedef struct {
+    uint32_t *buffer;
+    uint16_t size;
+    volatile uint16_t head;
+    volatile uint16_t tail;
+    bool _init;
+  } mjl_ring_spsc_s;
+
+  /* Power of Two State Object
+  * Indices are free running and wrapped with a mask, no division is required */
+  typedef struct {
+    uint32_t *buffer;
+    uint16_t mask;
+    bool overWrite;
+    uint16_t head;
+    uint16_t tail;
+    bool _init;
+  } mjl_ring_pow2_s;
+
   /* Default config struct */
   extern const mjl_ring_cfg_s mjl_ring_cfg_default;
   /***************************************
@@ -60,6 +100,24 @@
   bool mjl_ringBuffer_isBufferFull(mjl_ring_s *const state);
   bool mjl_ringBuffer_isBufferEmpty(mjl_ring_s *const state);
 
+  /* Zero-copy Operations */
+  uint32_t mjl_ringBuffer_peekRead(mjl_ring_s *const state, mjl_ring_span_s *first, mjl_ring_span_s *second);
+  uint32_t mjl_ringBuffer_commitRead(mjl_ring_s *const state, uint16_t num);
+  uint32_t mjl_ringBuffer_peekWrite(mjl_ring_s *const state, mjl_ring_span_s *first, mjl_ring_span_s *second);
+  uint32_t mjl_ringBuffer_commitWrite(mjl_ring_s *const state, uint16_t num);
+
+  /* Single Producer/Single Consumer Operations */
+  uint32_t mjl_ringBuffer_spsc_init(mjl_ring_spsc_s *const state, mjl_ring_cfg_s *const cfg);
+  uint32_t mjl_ringBuffer_spsc_enqueue(mjl_ring_spsc_s *const state, uint32_t in);
+  uint32_t mjl_ringBuffer_spsc_dequeue(mjl_ring_spsc_s *const state, uint32_t *out);
+  uint16_t mjl_ringBuffer_spsc_getCount(mjl_ring_spsc_s *const state);
+
+  /* Power of Two Operations */
+  uint32_t mjl_ringBuffer_pow2_init(mjl_ring_pow2_s *const state, mjl_ring_cfg_s *const cfg);
+  uint32_t mjl_ringBuffer_pow2_enqueue(mjl_ring_pow2_s *const state, uint32_t in);
+  uint32_t mjl_ringBuffer_pow2_dequeue(mjl_ring_pow2_s *const state, uint32_t *out);
+  uint16_t mjl_ringBuffer_pow2_getCount(mjl_ring_pow2_s *const state);
+
 
 #endif /* MJL_RING_BUFFER_H */
 /* [] END OF FILE */
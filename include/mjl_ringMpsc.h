@@ -0,0 +1,78 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringMpsc.h
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Multi-producer/single consumer ring buffer. Producers (e.g. several
+*   interrupt sources) reserve a slot by advancing the head with a compare and
+*   swap, fill it, then mark it committed through a per slot sequence number.
+*   The compare and swap uses LDREX/STREX where available (Cortex-M3/M4 and 
+*   host builds) and the critical section hooks on Cortex-M0/M0+.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_RING_MPSC_H
+  #define MJL_RING_MPSC_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <mjl_errors.h>
+  #include "mjl_ringBuffer.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  /* ARMv6-M has no exclusive access instructions */
+  #if defined(__ARM_ARCH_6M__)
+    #define MJL_RING_HAS_EXCLUSIVE    (0)
+  #else
+    #define MJL_RING_HAS_EXCLUSIVE    (1)
+  #endif
+
+  /***************************************
+  * Enumerated types
+  ***************************************/
+
+  /***************************************
+  * Structures 
+  ***************************************/
+  /* Storage slot */
+  typedef struct {
+    volatile uint32_t seq;  /* Slot sequence, marks the slot free or committed */
+    uint32_t value;
+  } mjl_ringMpsc_slot_s;
+
+  /* Configuration Structure */
+  typedef struct {
+    mjl_ringMpsc_slot_s *buffer;
+    uint16_t size;                            /* Must be a power of two */
+    uint32_t (*fn_criticalEnter)(void);       /* Disable interrupts, returns the previous state. Required on M0/M0+ */
+    void (*fn_criticalExit)(uint32_t);        /* Restore the interrupt state. Required on M0/M0+ */
+  } mjl_ringMpsc_cfg_s;
+
+  /* Multi-Producer State Object */
+  typedef struct {
+    mjl_ringMpsc_slot_s *buffer;
+    uint16_t mask;
+    uint32_t (*fn_criticalEnter)(void);
+    void (*fn_criticalExit)(uint32_t);
+    volatile uint32_t head;   /* Next slot to reserve, shared by the producers */
+    uint32_t tail;            /* Next slot to read, consumer only */
+    bool _init;
+  } mjl_ringMpsc_s;
+
+  /* Default config struct */
+  extern const mjl_ringMpsc_cfg_s mjl_ringMpsc_cfg_default;
+  /***************************************
+  * Function declarations 
+  ***************************************/
+  /* State Operations */
+  uint32_t mjl_ringMpsc_init(mjl_ringMpsc_s *const state, mjl_ringMpsc_cfg_s *const cfg);
+  uint32_t mjl_ringMpsc_enqueue(mjl_ringMpsc_s *const state, uint32_t in);
+  uint32_t mjl_ringMpsc_dequeue(mjl_ringMpsc_s *const state, uint32_t *out);
+
+#endif /* MJL_RING_MPSC_H */
+/* [] END OF FILE */
@@ -0,0 +1,73 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringRecord.h
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Variable length record queue. Records are stored contiguously as a 
+*   length prefix followed by the payload; a record that does not fit before
+*   the end of the storage is placed at the start instead. Writers reserve 
+*   and commit a whole record, readers get a pointer to a whole record.
+*   Safe for one producer and one consumer context without locking.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_RING_RECORD_H
+  #define MJL_RING_RECORD_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <mjl_errors.h>
+  #include "mjl_ringBuffer.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define MJL_RING_RECORD_HEADER_LEN    (2)       /* Bytes in the length prefix */
+  #define MJL_RING_RECORD_WRAP          (0xFFFF)  /* Length prefix marking the rest of the storage unused */
+  #define MJL_RING_RECORD_LEN_MAX       (0xFFFE)  /* Longest record payload */
+
+  /***************************************
+  * Enumerated types
+  ***************************************/
+
+  /***************************************
+  * Structures 
+  ***************************************/
+  /* Configuration Structure */
+  typedef struct {
+    uint8_t *buffer;
+    uint16_t size;
+  } mjl_ringRecord_cfg_s;
+
+  /* Record Queue State Object */
+  typedef struct {
+    uint8_t *buffer;
+    uint16_t size;
+    volatile uint16_t head;   /* Producer only */
+    volatile uint16_t tail;   /* Consumer only */
+    uint16_t reserveOffset;
+    uint16_t reserveLen;
+    bool isReserved;
+    bool _init;
+  } mjl_ringRecord_s;
+
+  /* Default config struct */
+  extern const mjl_ringRecord_cfg_s mjl_ringRecord_cfg_default;
+  /***************************************
+  * Function declarations 
+  ***************************************/
+  /* State Operations */
+  uint32_t mjl_ringRecord_init(mjl_ringRecord_s *const state, mjl_ringRecord_cfg_s *const cfg);
+  /* Producer Operations */
+  uint32_t mjl_ringRecord_reserve(mjl_ringRecord_s *const state, uint16_t len, uint8_t **payload);
+  uint32_t mjl_ringRecord_commit(mjl_ringRecord_s *const state, uint16_t len);
+  uint32_t mjl_ringRecord_write(mjl_ringRecord_s *const state, const uint8_t *data, uint16_t len);
+  /* Consumer Operations */
+  uint32_t mjl_ringRecord_peek(mjl_ringRecord_s *const state, uint8_t **payload, uint16_t *len);
+  uint32_t mjl_ringRecord_release(mjl_ringRecord_s *const state);
+
+#endif /* MJL_RING_RECORD_H */
+/* [] END OF FILE */
@@ -0,0 +1,79 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringStats.h
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Windowed statistics over the contents of a ring buffer. Keeps the 
+*   running sum and monotonic min/max deques up to date as elements are 
+*   enqueued, overwritten and dequeued, so queries are constant time. 
+*   All writes to the companion ring must go through this module.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_RING_STATS_H
+  #define MJL_RING_STATS_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <mjl_errors.h>
+  #include "mjl_ringBuffer.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+
+  /***************************************
+  * Enumerated types
+  ***************************************/
+
+  /***************************************
+  * Structures 
+  ***************************************/
+  /* Monotonic deque entry */
+  typedef struct {
+    uint32_t value;
+    uint32_t seq;     /* Sequence number of the element in the window */
+  } mjl_ringStats_entry_s;
+
+  /* Configuration Structure */
+  typedef struct {
+    mjl_ring_s *ring;                   /* Initialized companion ring holding the window */
+    mjl_ringStats_entry_s *minBuffer;   /* Deque storage, one entry per ring element */
+    mjl_ringStats_entry_s *maxBuffer;   /* Deque storage, one entry per ring element */
+  } mjl_ringStats_cfg_s;
+
+  /* Statistics State Object */
+  typedef struct {
+    mjl_ring_s *ring;
+    mjl_ringStats_entry_s *minBuffer;
+    mjl_ringStats_entry_s *maxBuffer;
+    uint16_t minHead;
+    uint16_t minCount;
+    uint16_t maxHead;
+    uint16_t maxCount;
+    uint64_t sum;
+    uint32_t seqHead;   /* Sequence number of the next element */
+    uint32_t seqTail;   /* Sequence number of the oldest element */
+    bool _init;
+  } mjl_ringStats_s;
+
+  /* Default config struct */
+  extern const mjl_ringStats_cfg_s mjl_ringStats_cfg_default;
+  /***************************************
+  * Function declarations 
+  ***************************************/
+  /* State Operations */
+  uint32_t mjl_ringStats_init(mjl_ringStats_s *const state, mjl_ringStats_cfg_s *const cfg);
+  uint32_t mjl_ringStats_enqueue(mjl_ringStats_s *const state, uint32_t in);
+  uint32_t mjl_ringStats_dequeue(mjl_ringStats_s *const state, uint32_t *out);
+  /* Queries */
+  uint32_t mjl_ringStats_getMin(mjl_ringStats_s *const state, uint32_t *min);
+  uint32_t mjl_ringStats_getMax(mjl_ringStats_s *const state, uint32_t *max);
+  uint32_t mjl_ringStats_getSum(mjl_ringStats_s *const state, uint64_t *sum);
+  uint32_t mjl_ringStats_getMean(mjl_ringStats_s *const state, uint32_t *mean);
+
+#endif /* MJL_RING_STATS_H */
+/* [] END OF FILE */
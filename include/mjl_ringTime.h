@@ -0,0 +1,70 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringTime.h
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: History ring of timestamped samples. Timestamps are monotonic, so 
+*   samples can be looked up by time with a binary search and a time window 
+*   can be decimated to a fixed number of points in O(log N + points).
+*   Timestamps may wrap, as long as the history spans less than 2^31 ticks.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_RING_TIME_H
+  #define MJL_RING_TIME_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <mjl_errors.h>
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+
+  /***************************************
+  * Enumerated types
+  ***************************************/
+
+  /***************************************
+  * Structures 
+  ***************************************/
+  /* Timestamped sample */
+  typedef struct {
+    uint32_t time;    /* Monotonic timestamp, e.g. [ms] */
+    uint32_t value;
+  } mjl_ringTime_sample_s;
+
+  /* Configuration Structure */
+  typedef struct {
+    mjl_ringTime_sample_s *buffer;
+    uint16_t size;
+  } mjl_ringTime_cfg_s;
+
+  /* History State Object - the oldest sample is overwritten when full */
+  typedef struct {
+    mjl_ringTime_sample_s *buffer;
+    uint16_t size;
+    uint16_t head;
+    uint16_t tail;
+    uint16_t count;
+    bool _init;
+  } mjl_ringTime_s;
+
+  /* Default config struct */
+  extern const mjl_ringTime_cfg_s mjl_ringTime_cfg_default;
+  /***************************************
+  * Function declarations 
+  ***************************************/
+  /* State Operations */
+  uint32_t mjl_ringTime_init(mjl_ringTime_s *const state, mjl_ringTime_cfg_s *const cfg);
+  uint32_t mjl_ringTime_enqueue(mjl_ringTime_s *const state, uint32_t time, uint32_t value);
+  uint32_t mjl_ringTime_get(mjl_ringTime_s *const state, uint16_t idx, mjl_ringTime_sample_s *sample);
+  /* Time Operations */
+  uint32_t mjl_ringTime_findTime(mjl_ringTime_s *const state, uint32_t time, uint16_t *idx);
+  uint32_t mjl_ringTime_decimate(mjl_ringTime_s *const state, uint32_t timeStart, uint32_t timeEnd, mjl_ringTime_sample_s *out, uint16_t num, uint16_t *numOut);
+
+#endif /* MJL_RING_TIME_H */
+/* [] END OF FILE */
@@ -0,0 +1,184 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringTyped.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Ring buffers sized to their element type. Same semantics as
+*   mjl_ringBuffer, generated per type with MJL_RING_TYPED_DECLARE() in a
+*   header and MJL_RING_TYPED_DEFINE() in one source file.
+*
+*   MJL_RING_TYPED_DECLARE(mjl_ring_u8, uint8_t) provides
+*     mjl_ring_u8_cfg_s, mjl_ring_u8_s, mjl_ring_u8_span_s
+*     mjl_ring_u8_init(), mjl_ring_u8_enqueue(), mjl_ring_u8_dequeue()
+*     mjl_ring_u8_isBufferFull(), mjl_ring_u8_isBufferEmpty()
+*     mjl_ring_u8_peekRead(), mjl_ring_u8_commitRead()
+*     mjl_ring_u8_peekWrite(), mjl_ring_u8_commitWrite()
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_RING_TYPED_H
+  #define MJL_RING_TYPED_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <mjl_errors.h>
+  #include "mjl_metrics.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  /* Declare the structures and functions of a typed ring */
+  #define MJL_RING_TYPED_DECLARE(name, type)                                                  \
+    typedef struct {                                                                          \
+      type *buffer;                                                                           \
+      uint16_t size;                                                                          \
+      bool overWrite;                                                                         \
+    } name##_cfg_s;                                                                           \
+    typedef struct {                                                                          \
+      type *buffer;                                                                           \
+      uint16_t size;                                                                          \
+      bool overWrite;                                                                         \
+      uint16_t head;                                                                          \
+      uint16_t tail;                                                                          \
+      uint16_t count;                                                                         \
+      bool _init;                                                                             \
+    } name##_s;                                                                               \
+    typedef struct {                                                                          \
+      type *data;                                                                             \
+      uint16_t len;                                                                           \
+    } name##_span_s;                                                                          \
+    uint32_t name##_init(name##_s *const state, name##_cfg_s *const cfg);                     \
+    uint32_t name##_enqueue(name##_s *const state, type in);                                  \
+    uint32_t name##_dequeue(name##_s *const state, type *out);                                \
+    bool name##_isBufferFull(name##_s *const state);                                          \
+    bool name##_isBufferEmpty(name##_s *const state);                                         \
+    uint32_t name##_peekRead(name##_s *const state, name##_span_s *first, name##_span_s *second);  \
+    uint32_t name##_commitRead(name##_s *const state, uint16_t num);                          \
+    uint32_t name##_peekWrite(name##_s *const state, name##_span_s *first, name##_span_s *second); \
+    uint32_t name##_commitWrite(name##_s *const state, uint16_t num);
+
+  /* Define the functions of a typed ring, once per type in a source file */
+  #define MJL_RING_TYPED_DEFINE(name, type)                                                   \
+    uint32_t name##_init(name##_s *const state, name##_cfg_s *const cfg){                     \
+      uint32_t error = 0;                                                                     \
+      error |= (NULL == state) ? ERROR_POINTER : ERROR_NONE;                                  \
+      error |= (NULL == cfg) ? ERROR_POINTER : ERROR_NONE;                                    \
+      if(!error){                                                                             \
+        error |= (NULL == cfg->buffer) ? ERROR_POINTER : ERROR_NONE;                          \
+        error |= (0 == cfg->size) ? ERROR_VAL : ERROR_NONE;                                   \
+      }                                                                                       \
+      if(!error){                                                                             \
+        state->buffer = cfg->buffer;                                                          \
+        state->size = cfg->size;                                                              \
+        state->overWrite = cfg->overWrite;                                                    \
+        state->head = 0;                                                                      \
+        state->tail = 0;                                                                      \
+        state->count = 0;                                                                     \
+        state->_init = true;                                                                  \
+      }                                                                                       \
+      if(error && (NULL != state)){state->_init=false;}                                       \
+      return error;                                                                           \
+    }                                                                                         \
+    uint32_t name##_enqueue(name##_s *const state, type in){                                  \
+      uint32_t error = 0;                                                                     \
+      if(!state->_init){error|=ERROR_INIT;}                                                   \
+      else if(name##_isBufferFull(state)){                                                    \
+        if(false == state->overWrite){error|=ERROR_STATE;}                                    \
+        else {                                                                                \
+          MJL_METRIC_INC(MJL_METRIC_RING_OVERWRITES);                                         \
+          state->tail = mjl_ringTyped_advance(state->tail, 1, state->size);                   \
+          state->count--;                                                                     \
+        }                                                                                     \
+      }                                                                                       \
+      if(!error){                                                                             \
+        state->buffer[state->head] = in;                                                      \
+        state->head = mjl_ringTyped_advance(state->head, 1, state->size);                     \
+        state->count++;                                                                       \
+      }                                                                                       \
+      return error;                                                                           \
+    }                                                                                         \
+    uint32_t name##_dequeue(name##_s *const state, type *out){                                \
+      uint32_t error = 0;                                                                     \
+      if(!state->_init){error|=ERROR_INIT;}                                                   \
+      else if(name##_isBufferEmpty(state)){error|=ERROR_STATE;}                               \
+      if(!error){                                                                             \
+        *out = state->buffer[state->tail];                                                    \
+        state->tail = mjl_ringTyped_advance(state->tail, 1, state->size);                     \
+        state->count--;                                                                       \
+      }                                                                                       \
+      return error;                                                                           \
+    }                                                                                         \
+    bool name##_isBufferFull(name##_s *const state){                                          \
+      return state->count == state->size;                                                     \
+    }                                                                                         \
+    bool name##_isBufferEmpty(name##_s *const state){                                         \
+      return state->count == 0;                                                               \
+    }                                                                                         \
+    uint32_t name##_peekRead(name##_s *const state, name##_span_s *first, name##_span_s *second){  \
+      uint32_t error = 0;                                                                     \
+      if(!state->_init){error|=ERROR_INIT;}                                                   \
+      if((NULL == first) || (NULL == second)){error|=ERROR_POINTER;}                          \
+      if(!error){                                                                             \
+        uint16_t toEnd = state->size - state->tail;                                           \
+        first->data = &state->buffer[state->tail];                                            \
+        first->len = (state->count < toEnd) ? state->count : toEnd;                           \
+        second->data = state->buffer;                                                         \
+        second->len = state->count - first->len;                                              \
+      }                                                                                       \
+      return error;                                                                           \
+    }                                                                                         \
+    uint32_t name##_commitRead(name##_s *const state, uint16_t num){                          \
+      uint32_t error = 0;                                                                     \
+      if(!state->_init){error|=ERROR_INIT;}                                                   \
+      else if(num > state->count){error|=ERROR_VAL;}                                          \
+      if(!error){                                                                             \
+        state->tail = mjl_ringTyped_advance(state->tail, num, state->size);                   \
+        state->count -= num;                                                                  \
+      }                                                                                       \
+      return error;                                                                           \
+    }                                                                                         \
+    uint32_t name##_peekWrite(name##_s *const state, name##_span_s *first, name##_span_s *second){ \
+      uint32_t error = 0;                                                                     \
+      if(!state->_init){error|=ERROR_INIT;}                                                   \
+      if((NULL == first) || (NULL == second)){error|=ERROR_POINTER;}                          \
+      if(!error){                                                                             \
+        uint16_t space = state->size - state->count;                                          \
+        uint16_t toEnd = state->size - state->head;                                           \
+        first->data = &state->buffer[state->head];                                            \
+        first->len = (space < toEnd) ? space : toEnd;                                         \
+        second->data = state->buffer;                                                         \
+        second->len = space - first->len;                                                     \
+      }                                                                                       \
+      return error;                                                                           \
+    }                                                                                         \
+    uint32_t name##_commitWrite(name##_s *const state, uint16_t num){                         \
+      uint32_t error = 0;                                                                     \
+      if(!state->_init){error|=ERROR_INIT;}                                                   \
+      else if(num > (state->size - state->count)){error|=ERROR_VAL;}                          \
+      if(!error){                                                                             \
+        state->head = mjl_ringTyped_advance(state->head, num, state->size);                   \
+        state->count += num;                                                                  \
+      }                                                                                       \
+      return error;                                                                           \
+    }
+
+  /***************************************
+  * Function declarations
+  ***************************************/
+  /* Advance an index by num elements without a division */
+  static inline uint16_t mjl_ringTyped_advance(uint16_t idx, uint16_t num, uint16_t size){
+    uint32_t next = (uint32_t) idx + num;
+    return (next >= size) ? (uint16_t) (next - size) : (uint16_t) next;
+  }
+
+  /* Library provided instantiations */
+  MJL_RING_TYPED_DECLARE(mjl_ring_u8, uint8_t)
+  MJL_RING_TYPED_DECLARE(mjl_ring_i16, int16_t)
+  MJL_RING_TYPED_DECLARE(mjl_ring_u16, uint16_t)
+  MJL_RING_TYPED_DECLARE(mjl_ring_f32, float)
+
+#endif /* MJL_RING_TYPED_H */
+/* [] END OF FILE */
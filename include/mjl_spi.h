@@ -18,23 +18,77 @@
   ***************************************/
   #include <stdbool.h>
   #include <stdint.h>
+  #include "mjl_dma.h"
   /***************************************
   * Macro Definitions
   ***************************************/
-
+  #define MJL_SPI_FIFO_DEPTH_DEFAULT    (8)   /* Bytes kept in flight by the transaction queue when opt_fifoDepth is 0 */
+  #define MJL_SPI_DEVICE_MAX            (4)   /* Devices that can be registered on one bus */
+  #define MJL_SPI_DMA_MIN_LEN_DEFAULT   (32)  /* Shortest queued chunk moved by DMA when opt_dmaMinLen is 0 */
+  #ifndef MJL_SPI_STALL_MAX
+    #define MJL_SPI_STALL_MAX           (1000000u)  /* Polls without a byte moving before a blocking exchange gives up */
+  #endif
   /***************************************
   * Enumerated types
   ***************************************/
+  /* Clock polarity and phase */
+  typedef enum {
+    MJL_SPI_MODE_0 = 0,   /* CPOL 0, CPHA 0 */
+    MJL_SPI_MODE_1 = 1,   /* CPOL 0, CPHA 1 */
+    MJL_SPI_MODE_2 = 2,   /* CPOL 1, CPHA 0 */
+    MJL_SPI_MODE_3 = 3,   /* CPOL 1, CPHA 1 */
+  } MJL_SPI_MODE_T;
+  /* Transaction queue priority */
+  typedef enum {
+    MJL_SPI_PRIORITY_LOW = 0,   /* Bulk traffic, e.g. display flushes */
+    MJL_SPI_PRIORITY_HIGH = 1,  /* Time critical accesses, run between chunks of low priority transfers */
+    MJL_SPI_PRIORITY_NUM,
+  } MJL_SPI_PRIORITY_T;
 
   /***************************************
   * Structures 
   ***************************************/
    /* Forward declare struct */
   typedef struct MJL_SPI_S MJL_SPI_T;
+  /* Queued transaction. Owned by the driver from spi_queueTransfer() until fn_complete runs */
+  typedef struct MJL_SPI_XFER_S {
+    uint8_t id;                                   /* Slave ID to select */
+    const uint8_t *tx;                            /* Data to send, NULL sends dummy bytes (0) */
+    uint8_t *rx;                                  /* Received data, NULL discards it */
+    uint16_t len;                                 /* Number of bytes to exchange */
+    void (*fn_complete)(struct MJL_SPI_XFER_S *const xfer, uint32_t error);  /* Optional, called from the servicing context */
+    void *context;                                /* User data for the completion callback */
+    MJL_SPI_PRIORITY_T priority;                  /* Queue to join */
+    bool isSplittable;                            /* Low priority only, may be split into chunkLen transfers each with its own CS assertion */
+    /* Private */
+    volatile bool _busy;
+    uint16_t _txIdx;
+    uint16_t _rxIdx;
+    uint16_t _chunkEnd;
+    uint32_t _queuedTicks;
+    uint32_t _error;
+    struct MJL_SPI_XFER_S *_next;
+  } MJL_SPI_XFER_S;
+  /* Bus settings of one slave, registered with spi_registerDevice(). Must stay valid while registered */
+  typedef struct {
+    uint8_t id;                                   /* Slave ID */
+    MJL_SPI_MODE_T mode;                          /* Clock polarity and phase */
+    uint32_t maxClockHz;                          /* Fastest clock the slave accepts */
+    bool csActiveHigh;                            /* Chip select polarity */
+  } MJL_SPI_DEVICE_S;
+  /* One segment of a transaction run under a single chip select, see spi_transferSegments() */
+  typedef struct {
+    const uint8_t *tx;                            /* Data to send, NULL sends dummy bytes (0) */
+    uint8_t *rx;                                  /* Received data, NULL discards it */
+    uint16_t len;                                 /* Number of bytes to exchange */
+    void (*fn_before)(uint8_t arg);               /* Optional, called after the previous segment has fully shifted (e.g. D/C pin) */
+    uint8_t arg;                                  /* Argument of fn_before */
+  } MJL_SPI_SEG_S;
   /* Configuration Structure */
   typedef struct {
     uint32_t (*req_hal_writeArray_blocking)(const uint8_t *array, uint16_t len);  /* Write data into the TX buffer */
     uint32_t (*req_hal_read)(uint8_t *result);                            /* Move data from the RX buffer to the result */
+    uint32_t (*opt_hal_readArray)(uint8_t *result, uint16_t len);       /* Optional bulk move of len elements from the RX buffer */
     uint32_t (*req_hal_setActive) (uint8_t id);                          /* Set the Slave with given ID active */
     uint32_t (*req_hal_getRxBufferNum) (void);                /* Get the number of elements in the Receive Buffer */
     uint32_t (*req_hal_getTxBufferNum) (void);                /* Get the number of elements in the Transmit Buffer */
@@ -42,12 +96,25 @@
     uint32_t (*req_hal_clearTxBuffer) (void);                            /* Clear the Transmit Buffer */
     uint32_t (*opt_hal_externalStart)(MJL_SPI_T *const);                 /* Optional External start function */
     uint32_t (*opt_hal_externalStop)(MJL_SPI_T *const);                  /* Optional External stop function */
+    uint32_t (*opt_hal_setIrq)(bool enable);                             /* Optional RX FIFO not-empty interrupt enable, for the transaction queue */
+    uint32_t (*opt_hal_csAssert)(uint8_t id);                            /* Optional software chip select, held for a whole transaction */
+    void (*opt_hal_csDeassert)(void);                                    /* Optional software chip select release */
+    uint32_t (*opt_hal_configure)(const MJL_SPI_DEVICE_S *device);       /* Optional, apply the clock, mode and CS polarity of a device */
+    uint32_t (*opt_hal_getTicks)(void);                                  /* Optional free running timer, to measure queue latency */
+    uint32_t (*opt_hal_dmaStart)(MJL_DMA_DESC_S *const desc);           /* Optional, exchange a queued chunk by DMA, see mjl_dma.h */
+    void (*opt_hal_dmaAbort)(void);                                      /* Optional, stop a running DMA transfer without completing it */
+    uint32_t (*opt_hal_criticalEnter)(void);                             /* Disable interrupts, returns the previous state. Required with opt_hal_dmaStart */
+    void (*opt_hal_criticalExit)(uint32_t intState);                     /* Restore the interrupt state. Required with opt_hal_dmaStart */
+    uint16_t opt_fifoDepth;                                              /* Optional FIFO depth in bytes, 0 uses MJL_SPI_FIFO_DEPTH_DEFAULT */
+    uint16_t opt_chunkLen;                                               /* Optional chunk size of splittable low priority transfers, 0 never splits */
+    uint16_t opt_dmaMinLen;                                              /* Optional, shorter chunks are moved by the CPU. 0 uses MJL_SPI_DMA_MIN_LEN_DEFAULT */
   } MJL_SPI_CFG_S;
 
   /* Serial State Object   */
   typedef struct {
     uint32_t (*req_hal_writeArray_blocking)(const uint8_t *array, uint16_t len);  /* Write data into the TX buffer */
     uint32_t (*req_hal_read)(uint8_t *result);                           /* Move data from the RX buffer to the result */
+    uint32_t (*opt_hal_readArray)(uint8_t *result, uint16_t len);       /* Optional bulk move of len elements from the RX buffer */
     uint32_t (*req_hal_setActive) (uint8_t id);                          /* Set the Slave with given ID active */
     uint32_t (*req_hal_getRxBufferNum) (void);                /* Get the number of elements in the Receive Buffer */
     uint32_t (*req_hal_getTxBufferNum) (void);                /* Get the number of elements in the Transmit Buffer */
@@ -55,7 +122,31 @@
     uint32_t (*req_hal_clearTxBuffer) (void);                            /* Clear the Transmit Buffer */
     uint32_t (*opt_hal_externalStart)(MJL_SPI_T *const);                 /* Optional External start function */
     uint32_t (*opt_hal_externalStop)(MJL_SPI_T *const);                  /* Optional External stop function */
+    uint32_t (*opt_hal_setIrq)(bool enable);                             /* Optional RX FIFO not-empty interrupt enable, for the transaction queue */
+    uint32_t (*opt_hal_csAssert)(uint8_t id);                            /* Optional software chip select, held for a whole transaction */
+    void (*opt_hal_csDeassert)(void);                                    /* Optional software chip select release */
+    uint32_t (*opt_hal_configure)(const MJL_SPI_DEVICE_S *device);       /* Optional, apply the clock, mode and CS polarity of a device */
+    uint32_t (*opt_hal_getTicks)(void);                                  /* Optional free running timer, to measure queue latency */
+    uint32_t (*opt_hal_dmaStart)(MJL_DMA_DESC_S *const desc);           /* Optional, exchange a queued chunk by DMA, see mjl_dma.h */
+    void (*opt_hal_dmaAbort)(void);                                      /* Optional, stop a running DMA transfer without completing it */
+    uint32_t (*opt_hal_criticalEnter)(void);                             /* Disable interrupts, returns the previous state. Required with opt_hal_dmaStart */
+    void (*opt_hal_criticalExit)(uint32_t intState);                     /* Restore the interrupt state. Required with opt_hal_dmaStart */
+    uint16_t fifoDepth;                                                  /* Maximum bytes in flight */
+    uint16_t chunkLen;                                                   /* Chunk size of splittable low priority transfers */
+    uint16_t dmaMinLen;                                                  /* Shortest chunk moved by DMA */
+    uint32_t maxWaitTicks[MJL_SPI_PRIORITY_NUM];                         /* Longest time from queueing to the start of a transfer */
+
+    const MJL_SPI_DEVICE_S *devices[MJL_SPI_DEVICE_MAX];                 /* Registered devices */
+    uint8_t numDevices;
 
+    const MJL_SPI_DEVICE_S *_activeDevice;
+    MJL_SPI_XFER_S *volatile _queueHead[MJL_SPI_PRIORITY_NUM];
+    MJL_SPI_XFER_S *_queueTail[MJL_SPI_PRIORITY_NUM];
+    MJL_SPI_XFER_S *_active;
+    MJL_DMA_DESC_S _dma;
+    bool _irqEnabled;
+    bool _inService;
+    volatile bool _reService;
     bool _init;
     bool _running;
   } MJL_SPI_S;
@@ -69,10 +160,20 @@
   uint32_t spi_init(MJL_SPI_S *const state, MJL_SPI_CFG_S *const cfg);
   uint32_t spi_start(MJL_SPI_S *const state);
   uint32_t spi_stop(MJL_SPI_S *const state);
+  uint32_t spi_registerDevice(MJL_SPI_S *const state, const MJL_SPI_DEVICE_S *device);
   uint32_t spi_writeArray_blocking(MJL_SPI_S *const state, uint8_t id, uint8_t * array, uint16_t len);
   uint32_t spi_readArray(MJL_SPI_S *const state,  uint8_t id, uint8_t * array, uint16_t len);
   uint32_t spi_write(MJL_SPI_S *const state, uint8_t id, uint8_t data);
   uint32_t spi_read(MJL_SPI_S *const state,  uint8_t id, uint8_t * data);
+  uint32_t spi_transfer(MJL_SPI_S *const state, uint8_t id, const uint8_t *tx, uint8_t *rx, uint16_t len);
+  uint32_t spi_transferSegments(MJL_SPI_S *const state, uint8_t id, const MJL_SPI_SEG_S *segs, uint8_t num);
+  /* Transaction queue */
+  uint32_t spi_queueTransfer(MJL_SPI_S *const state, MJL_SPI_XFER_S *const xfer);
+  uint32_t spi_serviceQueue(MJL_SPI_S *const state);
+  bool spi_isQueueIdle(MJL_SPI_S *const state);
+  bool spi_isTransferBusy(MJL_SPI_XFER_S *const xfer);
+  uint32_t spi_getMaxWait(MJL_SPI_S *const state, MJL_SPI_PRIORITY_T priority, uint32_t *ticks);
+  uint32_t spi_resetMaxWait(MJL_SPI_S *const state);
     
 #endif /* MJL_SPI_H */
 /* [] END OF FILE */
\ No newline at end of file
@@ -0,0 +1,101 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_telemetry.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Binary telemetry over a uart. Samples are batched into frames with
+*   a sequence number and a CRC, then COBS encoded so a 0x00 byte marks the
+*   end of every frame. tools/mjl_telemetry_decode.py decodes a capture and
+*   reports lost and corrupt frames.
+*
+*   Frame before encoding, little endian
+*     MJL_TELEM_VERSION
+*     uint16_t sequence number, incremented per frame, also for dropped ones
+*     uint32_t ticks of opt_getTicks at the first sample, 0 without it
+*     uint8_t number of records
+*     records of channel (uint8_t), MJL_TELEM_KIND_T (uint8_t), value
+*     uint16_t CRC-16/CCITT-FALSE of every previous byte
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef MJL_TELEMETRY_H
+  #define MJL_TELEMETRY_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdbool.h>
+  #include <stdint.h>
+  #include <mjl_errors.h>
+  #include "mjl_uart.h"
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  #define MJL_TELEM_VERSION       (1)
+  #define MJL_TELEM_HEADER_LEN    (8)     /* Version, sequence, ticks and count */
+  #define MJL_TELEM_CRC_LEN       (2)
+  #define MJL_TELEM_RECORD_MAX    (6)     /* Channel, kind and a 32 bit value */
+  #define MJL_TELEM_CRC_INIT      (0xFFFF)
+  /* Raw frame bytes for num records of 32 bit values */
+  #define MJL_TELEM_RAW_LEN(num)    (MJL_TELEM_HEADER_LEN + ((num) * MJL_TELEM_RECORD_MAX) + MJL_TELEM_CRC_LEN)
+  /* Smallest buffer for num records, adds the COBS overhead and the delimiter */
+  #define MJL_TELEM_BUFFER_LEN(num) (MJL_TELEM_RAW_LEN(num) + 2 + ((MJL_TELEM_RAW_LEN(num) + 253) / 254))
+  /***************************************
+  * Enumerated types
+  ***************************************/
+  /* Type of a sample value */
+  typedef enum {
+    MJL_TELEM_KIND_I16,     /* int16_t, 2 bytes */
+    MJL_TELEM_KIND_I32,     /* int32_t, 4 bytes */
+    MJL_TELEM_KIND_U32,     /* uint32_t, 4 bytes */
+    MJL_TELEM_KIND_FLOAT,   /* IEEE-754 float, 4 bytes */
+    MJL_TELEM_KIND_NUM,
+  } MJL_TELEM_KIND_T;
+
+  /***************************************
+  * Structures
+  ***************************************/
+  /* Configuration Structure */
+  typedef struct {
+    MLJ_UART_S *uart;                 /* Initialized uart the frames are written to */
+    uint8_t *buffer;                  /* Frame storage, raw and COBS encoded in place */
+    uint16_t bufferLen;               /* Bytes of buffer, see MJL_TELEM_BUFFER_LEN() */
+    uint8_t opt_samplesPerFrame;      /* Send after this many samples, 0 to send when the buffer is full */
+    uint32_t (*opt_getTicks)(void);   /* Optional, timestamp each frame */
+  } MJL_TELEM_CFG_S;
+
+  /* Telemetry State Object */
+  typedef struct {
+    MLJ_UART_S *uart;
+    uint8_t *buffer;
+    uint16_t bufferLen;
+    uint8_t samplesPerFrame;
+    uint32_t (*opt_getTicks)(void);
+    uint16_t _rawStart;               /* First raw byte, room is left in front for the COBS overhead */
+    uint16_t _rawMax;                 /* Raw bytes that fit, CRC included */
+    uint16_t _rawLen;                 /* Raw bytes of the frame being built */
+    uint8_t _count;                   /* Records of the frame being built */
+    uint16_t seq;                     /* Sequence number of the next frame */
+    uint32_t framesSent;
+    uint32_t framesDropped;           /* Frames the uart did not accept */
+    bool _init;
+  } MJL_TELEM_S;
+
+  /* Default config struct */
+  extern const MJL_TELEM_CFG_S mjl_telem_cfg_default;
+  /***************************************
+  * Function declarations
+  ***************************************/
+  uint32_t mjl_telem_init(MJL_TELEM_S *const state, MJL_TELEM_CFG_S *const cfg);
+  uint32_t mjl_telem_addI16(MJL_TELEM_S *const state, uint8_t channel, int16_t value);
+  uint32_t mjl_telem_addI32(MJL_TELEM_S *const state, uint8_t channel, int32_t value);
+  uint32_t mjl_telem_addU32(MJL_TELEM_S *const state, uint8_t channel, uint32_t value);
+  uint32_t mjl_telem_addFloat(MJL_TELEM_S *const state, uint8_t channel, float value);
+  uint32_t mjl_telem_flush(MJL_TELEM_S *const state);
+  uint16_t mjl_telem_crc16(uint16_t crc, const uint8_t *data, uint16_t len);
+  uint16_t mjl_telem_cobsEncode(uint8_t *buffer, uint16_t start, uint16_t len);
+
+#endif /* MJL_TELEMETRY_H */
+/* [] END OF FILE */
@@ -18,6 +18,9 @@
   ***************************************/
   #include <stdbool.h>
   #include <stdint.h>
+  #include <stdarg.h>
+  #include "mjl_dma.h"
+  #include "mjl_ringTyped.h"
   /***************************************
   * Macro Definitions
   ***************************************/
@@ -32,33 +35,86 @@
   #define BYTES_PER_UINT32                    (4) /* Number of bytes in a uint32_t */
   #define UART_FLOAT_DEFAULT_PREC   (6u)
   #define UART_FLOAT_BUFFER_SIZE    (32u)
-  #define UART_MAX_FLOAT            (1e9)
+  #ifndef UART_PRINTF_BUFFER_LEN
+    #define UART_PRINTF_BUFFER_LEN  (64u)   /* Stack buffer of uart_printf, bytes per HAL write */
+  #endif
+  #ifndef UART_TX_STALL_MAX
+    #define UART_TX_STALL_MAX       (1000000u)  /* Passes over the TX ring without progress before uart_flush() or a blocked write gives up */
+  #endif
 
   /***************************************
   * Enumerated types
   ***************************************/
+  /* What a write does when the TX ring is full */
+  typedef enum {
+    MJL_UART_TX_POLICY_BLOCK,       /* Wait for space, draining the ring from the caller */
+    MJL_UART_TX_POLICY_DROP,        /* Discard the whole write */
+    MJL_UART_TX_POLICY_OVERWRITE,   /* Discard the oldest queued bytes */
+  } MJL_UART_TX_POLICY_T;
 
   /***************************************
   * Structures 
   ***************************************/
   /* Forward declare struct */
   typedef struct MLJ_UART_S MLJ_UART_T;
+  /* Writer of uart_vformat() output */
+  typedef uint32_t (*MJL_UART_FMT_WRITE_T)(void *ctx, const uint8_t *array, uint16_t len);
+  /* TX ring statistics */
+  typedef struct {
+    uint32_t bytesQueued;       /* Bytes accepted into the ring */
+    uint32_t bytesDropped;      /* Bytes of writes discarded, never queued */
+    uint32_t bytesOverwritten;  /* Queued bytes discarded for newer ones */
+    uint32_t blockedWrites;     /* Writes that waited for space */
+    uint16_t highWater;         /* Most bytes queued at once */
+  } MJL_UART_TX_STATS_S;
   /* Configuration Structure */
   typedef struct {
     uint32_t (*hal_req_writeArray)(const uint8_t *array, uint16_t len);  /* Write data into the TX buffer */
     uint32_t (*hal_req_read)(uint8_t *result);         /* Move data from the RX buffer to the result */
     uint32_t (*hal_opt_externalStart)(MLJ_UART_T *const);              /* Optional External start function */
     uint32_t (*hal_opt_externalStop)(MLJ_UART_T *const);                        /* Optional External stop function */
+    uint32_t (*hal_opt_dmaStart)(MJL_DMA_DESC_S *const desc);          /* Optional, write desc->tx by DMA, see mjl_dma.h */
+    uint32_t (*hal_opt_getTxFree)(void);                                /* Optional, free space in the TX FIFO, to drain the TX ring */
+    uint32_t (*hal_opt_setTxIrq)(bool enable);                          /* Optional, TX FIFO not full interrupt, its handler calls uart_txIsr() */
+    uint32_t (*hal_opt_setRxIrq)(bool enable);                          /* RX FIFO not empty interrupt, its handler calls uart_rxIsr(), required with an RX ring */
+    uint32_t (*hal_opt_criticalEnter)(void);                            /* Disable interrupts, required with a TX or RX ring */
+    void (*hal_opt_criticalExit)(uint32_t intState);                    /* Restore interrupts, required with a TX or RX ring */
     uint32_t opt_baud; /* Baud rate */ 
+    uint8_t *opt_txBuffer;                /* Optional TX ring storage, writes return without waiting on the wire */
+    uint16_t opt_txBufferLen;             /* Bytes of opt_txBuffer */
+    MJL_UART_TX_POLICY_T opt_txPolicy;    /* Behaviour of a write to a full ring */
+    uint8_t *opt_rxBuffer;                /* Optional RX ring storage, filled from the RX interrupt */
+    uint16_t opt_rxBufferLen;             /* Bytes of opt_rxBuffer */
+    void (*opt_fn_rxReceived)(MLJ_UART_T *const state);                 /* Optional, called from uart_rxIsr() after bytes are queued */
   } MJL_UART_CFG_S;
 
   /* Serial State Object   */
-  typedef struct {
+  typedef struct MLJ_UART_S {
     uint32_t (*hal_req_writeArray)(const uint8_t *array, uint16_t len);  /* Write data into the TX buffer */
     uint32_t (*hal_req_read)(uint8_t *result);         /* Move data from the RX buffer to the result */
     uint32_t (*hal_opt_externalStart)(MLJ_UART_T *const);              /* Optional External start function */
     uint32_t (*hal_opt_externalStop)(MLJ_UART_T *const);                        /* Optional External stop function */
+    uint32_t (*hal_opt_dmaStart)(MJL_DMA_DESC_S *const desc);          /* Optional, write desc->tx by DMA, see mjl_dma.h */
+    uint32_t (*hal_opt_getTxFree)(void);                                /* Optional, free space in the TX FIFO, to drain the TX ring */
+    uint32_t (*hal_opt_setTxIrq)(bool enable);                          /* Optional, TX FIFO not full interrupt, its handler calls uart_txIsr() */
+    uint32_t (*hal_opt_setRxIrq)(bool enable);                          /* RX FIFO not empty interrupt, its handler calls uart_rxIsr(), required with an RX ring */
+    uint32_t (*hal_opt_criticalEnter)(void);                            /* Disable interrupts, required with a TX or RX ring */
+    void (*hal_opt_criticalExit)(uint32_t intState);                    /* Restore interrupts, required with a TX or RX ring */
+    void (*opt_fn_rxReceived)(MLJ_UART_T *const state);                 /* Optional, called from uart_rxIsr() after bytes are queued */
     uint32_t baud;
+    MJL_DMA_DESC_S *_dmaDesc;                                           /* Last descriptor handed to the DMA */
+    /* TX ring */
+    mjl_ring_u8_s _txRing;
+    MJL_UART_TX_POLICY_T txPolicy;
+    MJL_UART_TX_STATS_S txStats;
+    MJL_DMA_DESC_S _txDma;                /* Drains the ring when the DMA hook is present */
+    volatile uint16_t _txInFlight;        /* Bytes read out of the ring, owned by the DMA */
+    bool _isAsync;
+    bool _txIrqEnabled;
+    /* RX ring */
+    mjl_ring_u8_s _rxRing;
+    volatile uint32_t rxOverflow;         /* Bytes dropped because the RX ring was full */
+    bool _isRxAsync;
 
     bool _init;
     bool _running;
@@ -79,17 +135,42 @@
   uint32_t uart_read(MLJ_UART_S *const state, uint8_t * data);
   uint32_t uart_writeArray(MLJ_UART_S *const state, uint8_t * array, uint16_t len);
   uint32_t uart_readArray(MLJ_UART_S *const state, uint8_t * array, uint16_t len);
+  uint32_t uart_readAvailable(MLJ_UART_S *const state, uint8_t * array, uint16_t len, uint16_t *num);
   uint32_t uart_write_reverse(MLJ_UART_S *const state, uint8_t * array, uint16_t len);
-  uint32_t uart_print(MLJ_UART_S *const state, const char * pszFmt);
-  uint32_t uart_println(MLJ_UART_S *const state, const char * pszFmt);
-  uint32_t uart_printf(MLJ_UART_S* state, const char *pszFmt,...);
-  // uint32_t uart_printlnf(MLJ_UART_S* state, const char *pszFmt,...);
-  #define uart_printlnf(state,...)do{uart_printf(state,__VA_ARGS__); uart_println(state,"");}while(0)
+  uint32_t uart_writeArray_dma(MLJ_UART_S *const state, MJL_DMA_DESC_S *const desc);
+  bool uart_isDmaBusy(MLJ_UART_S *const state);
+  void uart_txIsr(MLJ_UART_S *const state);
+  void uart_rxIsr(MLJ_UART_S *const state);
+  uint32_t uart_flush(MLJ_UART_S *const state);
+  uint32_t uart_getTxStats(MLJ_UART_S *const state, MJL_UART_TX_STATS_S *const stats);
+  uint32_t uart_resetTxStats(MLJ_UART_S *const state);
+  uint32_t uart_vformat(MJL_UART_FMT_WRITE_T write, void *ctx, const char *pszFmt, va_list args);
+  #ifndef MJL_UART_PRINT_DISABLE
+    uint32_t uart_print(MLJ_UART_S *const state, const char * pszFmt);
+    uint32_t uart_println(MLJ_UART_S *const state, const char * pszFmt);
+    uint32_t uart_printf(MLJ_UART_S* state, const char *pszFmt,...);
+    uint32_t uart_vprintf(MLJ_UART_S* state, const char *pszFmt, va_list args);
+    // uint32_t uart_printlnf(MLJ_UART_S* state, const char *pszFmt,...);
+    #define uart_printlnf(state,...)do{uart_printf(state,__VA_ARGS__); uart_println(state,"");}while(0)
+  #else
+    /* Print calls do nothing and, from -Og up, their strings are dropped. Functions, not
+       expressions, so calls used as statements stay free of -Wunused-value */
+    static inline uint32_t uart_print(MLJ_UART_S *const state, const char * pszFmt){(void) state; (void) pszFmt; return ERROR_NONE;}
+    static inline uint32_t uart_println(MLJ_UART_S *const state, const char * pszFmt){(void) state; (void) pszFmt; return ERROR_NONE;}
+    static inline uint32_t uart_printf(MLJ_UART_S* state, const char *pszFmt,...){(void) state; (void) pszFmt; return ERROR_NONE;}
+    static inline uint32_t uart_vprintf(MLJ_UART_S* state, const char *pszFmt, va_list args){(void) state; (void) pszFmt; (void) args; return ERROR_NONE;}
+    #define uart_printlnf(state, ...)         do{ } while(0)
+  #endif
 
   /* Utility Operations */
-  uint32_t uart_printHeader(MLJ_UART_S* state, const char* name, const char *date, const char* time);
   uint32_t uart_hex2Ascii(uint8_t hex, uint8_t* ascii);
-  uint32_t uart_printError(MLJ_UART_S* state, const char *description, uint32_t code);
+  #ifndef MJL_UART_PRINT_DISABLE
+    uint32_t uart_printHeader(MLJ_UART_S* state, const char* name, const char *date, const char* time);
+    uint32_t uart_printError(MLJ_UART_S* state, const char *description, uint32_t code);
+  #else
+    static inline uint32_t uart_printHeader(MLJ_UART_S* state, const char* name, const char *date, const char* time){(void) state; (void) name; (void) date; (void) time; return ERROR_NONE;}
+    static inline uint32_t uart_printError(MLJ_UART_S* state, const char *description, uint32_t code){(void) state; (void) description; (void) code; return ERROR_NONE;}
+  #endif
   
 
 
@@ -98,7 +179,7 @@
   // uint32_t uart_compareReg(MLJ_UART_S* state, const char* name, uint16_t actual, uint16_t expected);
   // uint32_t uart_getInputFloat(MLJ_UART_S* state, float* result);
 
-  // uint32_t parseAsciiFloat(uint8_t* buf, uint16_t len, float* result);
+  uint32_t parseAsciiFloat(uint8_t* buf, uint16_t len, float* result);
 
     
 #endif /* MJL_UART_H */
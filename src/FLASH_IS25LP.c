@@ -16,6 +16,7 @@ const FLASH_IS25_CFG_S flash_is25_cfg_default = {
   .fn_delayUs = NULL,
   .fn_spi_writeArrayBlocking = NULL,
   .fn_spi_readArrayBlocking = NULL,
+  .fn_spi_transferSegments = NULL,
   .slaveId = 0,
 };
 
@@ -49,6 +50,7 @@ uint32_t flash_is25_init(FLASH_IS25_S *const state, FLASH_IS25_CFG_S *const cfg)
     state->fn_delayUs = cfg->fn_delayUs;
     state->fn_spi_writeArrayBlocking = cfg->fn_spi_writeArrayBlocking;
     state->fn_spi_readArrayBlocking = cfg->fn_spi_readArrayBlocking;
+    state->fn_spi_transferSegments = cfg->fn_spi_transferSegments;
     state->slaveId = cfg->slaveId;
     /* Mark as initialized */
     state->_init = true;
@@ -87,7 +89,17 @@ uint32_t flash_is25_start(FLASH_IS25_S *const state){
     /* Read from the Manufacturer ID */
     uint8_t idArray[IS25_RDMDID_LEN] = {0x00};
     idArray[0] = IS25_CMD_RDMDID;
-    error|=state->fn_spi_readArrayBlocking(state->slaveId, idArray, IS25_RDMDID_LEN);
+    if(NULL != state->fn_spi_transferSegments){
+      /* Command and address segment, then only the ID bytes are read back */
+      const MJL_SPI_SEG_S segs[2] = {
+        {.tx = idArray, .rx = NULL, .len = IS25_RDMDID_LEN_CMD, .fn_before = NULL, .arg = 0},
+        {.tx = NULL, .rx = &idArray[IS25_RDMDID_LEN_CMD], .len = IS25_RDMDID_LEN - IS25_RDMDID_LEN_CMD, .fn_before = NULL, .arg = 0},
+      };
+      error|=state->fn_spi_transferSegments(state->slaveId, segs, 2);
+    }
+    else {
+      error|=state->fn_spi_readArrayBlocking(state->slaveId, idArray, IS25_RDMDID_LEN);
+    }
     bool doesMfgIdMatch = (idArray[IS25_RDMDID_POS_MFG] == IS25_ID_MFG);
     bool doesDevIdMatch = (idArray[IS25_RDMDID_POS_DEV] == IS25_ID_DEV);
     if(doesMfgIdMatch && doesDevIdMatch){state->_running = true;}
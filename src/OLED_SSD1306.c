@@ -15,6 +15,7 @@
 #include "mjl_errors.h"
 #include <string.h>
 #include "mjl_font.h"
+#include "mjl_metrics.h"
 
 /*******************************************************************************
 * Function Name: SSD1306_init()
@@ -50,6 +51,7 @@ uint32_t SSD1306_init(ssd1306_state_s *const state, ssd1306_cfg_s *const cfg) {
       state->fn_pin_reset_write = cfg->fn_pin_reset_write;
       state->fn_pin_dataCommand_write = cfg->fn_pin_dataCommand_write;
       state->fn_delayUs = cfg->fn_delayUs;
+      state->fn_spi_transferSegments = cfg->fn_spi_transferSegments;
       /* Copy Value from cfg */
       state->fullWindow.colStart  = cfg->fullWindow.colStart;
       state->fullWindow.colEnd    = cfg->fullWindow.colEnd;
@@ -177,6 +179,7 @@ uint32_t SSD1306_writeDataArray(ssd1306_state_s *const state, const uint8_t * da
     state->fn_pin_dataCommand_write(SSD1306_DC_DATA);
     state->fn_delayUs(SSD1306_DELAY_US_DC);
     /* Write array and wait until complete */
+    MJL_METRIC_ADD(MJL_METRIC_DISPLAY_BYTES, len);
     error |= state->fn_spi_writeArrayBlocking(state->spi_slaveId, dataArray, len);
   }       
   return error;
@@ -206,6 +209,40 @@ uint32_t SSD1306_setWindow(ssd1306_state_s *const state, display_window_s *const
   return error;
 }
 
+/*******************************************************************************
+* Function Name: SSD1306_writeWindowData()
+********************************************************************************
+* \brief
+*   Set the drawing window and write screen data into it. With 
+*   fn_spi_transferSegments the window command and data go out as one bus 
+*   transaction, the D/C line switching between the segments.
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t SSD1306_writeWindowData(ssd1306_state_s *const state, display_window_s *const window, const uint8_t * dataArray, uint16_t len) {
+  uint32_t error = 0;
+  if(!state->_isInitialized){error|=ERROR_INIT;}
+
+  if(!error && (NULL != state->fn_spi_transferSegments)) {
+    uint8_t cmdArray[WINDOW_BUFFER_LEN] = {
+      SSD1306_CMD_COLUMN_ADDR, window->colStart, window->colEnd,
+      SSD1306_CMD_PAGE_ADDR, window->pageStart, window->pageEnd
+    };
+    const MJL_SPI_SEG_S segs[2] = {
+      {.tx = cmdArray, .rx = NULL, .len = WINDOW_BUFFER_LEN, .fn_before = state->fn_pin_dataCommand_write, .arg = SSD1306_DC_COMMAND},
+      {.tx = dataArray, .rx = NULL, .len = len, .fn_before = state->fn_pin_dataCommand_write, .arg = SSD1306_DC_DATA},
+    };
+    MJL_METRIC_ADD(MJL_METRIC_DISPLAY_BYTES, len);
+    error |= state->fn_spi_transferSegments(state->spi_slaveId, segs, 2);
+  }
+  else if(!error) {
+    error |= SSD1306_setWindow(state, window);
+    if(!error){error |= SSD1306_writeDataArray(state, dataArray, len);}
+  }
+  return error;
+}
+
 /*******************************************************************************
 * Function Name: SSD1306_setAddressingMode()
 ********************************************************************************
@@ -354,8 +391,7 @@ uint32_t SSD1306_setDigits_16x32(ssd1306_state_s *const state, const uint8_t **d
         /* Calculate the window */
         display_window_s window;
         error |= windowFromPos(pos, i, &window);
-        error |= SSD1306_setWindow(state, &window); 
-        error |= SSD1306_writeDataArray(state, newLetter, DISPLAY_LEN_16x32);
+        error |= SSD1306_writeWindowData(state, &window, newLetter, DISPLAY_LEN_16x32);
         if(error){break;}
       }
     }
@@ -392,9 +428,8 @@ uint32_t SSD1306_setLetters(ssd1306_state_s *const state, const uint8_t **letter
       /* Calculate the window */
       display_window_s window;
       error |= windowFromPos(pos, i, &window);
-      error |= SSD1306_setWindow(state, &window); 
       /* draw the digit */
-      error |= SSD1306_writeDataArray(state, letters[i], UI_TEXT_8x16_LEN); 
+      error |= SSD1306_writeWindowData(state, &window, letters[i], UI_TEXT_8x16_LEN); 
       if(error){break;}
     }
   }
@@ -471,10 +506,9 @@ uint32_t SSD1306_setIcon(ssd1306_state_s *const state, display_icon_s *const ico
   uint32_t error = 0;
   display_window_s window;
   error |= windowFromPos(&icon->pos, 0, &window);
-  if(!error){error|=SSD1306_setWindow(state, &window);}
   if(!error){
     uint16_t len = (icon->pos.size_cols * icon->pos.size_rows) / SSD1306_PAGE_HEIGHT; 
-    error|=SSD1306_writeDataArray(state, icon->data, len);
+    error|=SSD1306_writeWindowData(state, &window, icon->data, len);
   }
   
   return error;
@@ -499,14 +533,13 @@ uint32_t SSD1306_setIcon_inverse(ssd1306_state_s *const state, display_icon_s *c
   uint32_t error = 0;
   display_window_s window;
   error |= windowFromPos(&icon->pos, 0, &window);
-  if(!error){error|=SSD1306_setWindow(state, &window);}
   if(!error){
     uint16_t len = (icon->pos.size_cols * icon->pos.size_rows) / SSD1306_PAGE_HEIGHT;
     uint8_t invert[len];
     for(uint8_t i=0; i<len;i++){
       invert[i]=(~icon->data[i]);
     } 
-    error|=SSD1306_writeDataArray(state, invert, len);
+    error|=SSD1306_writeWindowData(state, &window, invert, len);
   }
   
   return error;
@@ -533,13 +566,12 @@ uint32_t SSD1306_clearIcon(ssd1306_state_s *const state, display_icon_s *const i
   uint32_t error = 0;
   display_window_s window;
   error |= windowFromPos(&icon->pos, 0, &window);
-  if(!error){error|=SSD1306_setWindow(state, &window);}
   if(!error){
     uint16_t len = (icon->pos.size_cols * icon->pos.size_rows) / SSD1306_PAGE_HEIGHT; 
     // TODO: Hacky way of avoiding using heap 
     uint8_t blankPage[SSD1306_NUM_COLS];
     memset(blankPage, 0, SSD1306_NUM_COLS);
-    error|=SSD1306_writeDataArray(state, blankPage, len);
+    error|=SSD1306_writeWindowData(state, &window, blankPage, len);
   }
   
   return error;
@@ -873,20 +905,17 @@ uint32_t display_updateGraphColumn(ssd1306_state_s *const state, display_graph_s
     window.pageEnd = graph->pageEnd;
     window.colStart  = graph->colStart + colIdx;
     window.colEnd = window.colStart;
-    error |= SSD1306_setWindow(state, &window);
-    if(!error){
-      /* Saturate at top of graph */
-      if(val>(graph->numRow-1)){val=(graph->numRow-1);}
-      /* Map the data onto the column */
-      uint64_t colData;
-      colData = (uint64_t) ((uint64_t) 1 << val);
-      /* Convert uint64_t to column */
-      uint8_t colDataBuffer[graph->numPage];
-      for(uint8_t pageIdx =0; pageIdx<graph->numPage; pageIdx++){
-        colDataBuffer[graph->numPage-pageIdx-1] = reverseBits((uint8_t) (colData >> (BITS_PER_BYTE *pageIdx)));
-      }
-      error |= SSD1306_writeDataArray(state, colDataBuffer, graph->numPage);   
+    /* Saturate at top of graph */
+    if(val>(graph->numRow-1)){val=(graph->numRow-1);}
+    /* Map the data onto the column */
+    uint64_t colData;
+    colData = (uint64_t) ((uint64_t) 1 << val);
+    /* Convert uint64_t to column */
+    uint8_t colDataBuffer[graph->numPage];
+    for(uint8_t pageIdx =0; pageIdx<graph->numPage; pageIdx++){
+      colDataBuffer[graph->numPage-pageIdx-1] = reverseBits((uint8_t) (colData >> (BITS_PER_BYTE *pageIdx)));
     }
+    error |= SSD1306_writeWindowData(state, &window, colDataBuffer, graph->numPage);   
   }
   return error;
 }
@@ -907,16 +936,51 @@ uint32_t display_updateGraphScroll(ssd1306_state_s *const state, display_graph_s
   if(!graph->_isInit){error|=ERROR_INIT;}
   
   if(!error){
-    for(uint8_t i=0; i<ring->count; i++){
-      uint8_t val = ring->buffer[(ring->tail+i)%ring->size];
-      error |= display_updateGraphColumn(state, graph, i, val);
-      if(error){break;}
+    mjl_ring_span_s spans[2];
+    error |= mjl_ringBuffer_peekRead(ring, &spans[0], &spans[1]);
+    /* Walk the oldest to newest samples in place */
+    uint8_t colIdx = 0;
+    for(uint8_t s=0; (s<2) && !error; s++){
+      for(uint16_t i=0; i<spans[s].len; i++){
+        error |= display_updateGraphColumn(state, graph, colIdx++, (uint8_t) spans[s].data[i]);
+        if(error){break;}
+      }
     }
   }
   return error;
 }
 
 
+/*******************************************************************************
+* Function Name: display_updateGraphScroll_u8()
+********************************************************************************
+* \brief
+*   Update all of the graph from a byte wide sample history
+*
+* \return
+*  None
+*******************************************************************************/
+uint32_t display_updateGraphScroll_u8(ssd1306_state_s *const state, display_graph_s *const graph, mjl_ring_u8_s *const ring){
+  uint32_t error = 0;
+  if(!state->_isInitialized){error|=ERROR_INIT;}
+  if(!ring->_init){error|=ERROR_INIT;}
+  if(!graph->_isInit){error|=ERROR_INIT;}
+  
+  if(!error){
+    mjl_ring_u8_span_s spans[2];
+    error |= mjl_ring_u8_peekRead(ring, &spans[0], &spans[1]);
+    /* Walk the oldest to newest samples in place */
+    uint8_t colIdx = 0;
+    for(uint8_t s=0; (s<2) && !error; s++){
+      for(uint16_t i=0; i<spans[s].len; i++){
+        error |= display_updateGraphColumn(state, graph, colIdx++, spans[s].data[i]);
+        if(error){break;}
+      }
+    }
+  }
+  return error;
+}
+
 /*******************************************************************************
 * Function Name: reverseBits()
 ********************************************************************************
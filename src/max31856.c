@@ -45,6 +45,11 @@ uint32_t max31856_init(max31856_state_s *const state, max31856_cfg_s *const cfg)
     /* Copy config params */
     state->spi = cfg->spi;
     state->slaveId = cfg->slaveId;
+    /* Bus settings of the device */
+    state->spiDevice.id = cfg->slaveId;
+    state->spiDevice.mode = MAX31856_SPI_MODE;
+    state->spiDevice.maxClockHz = MAX31856_SPI_CLOCK_MAX_HZ;
+    state->spiDevice.csActiveHigh = false;
     /* Mark as initialized */
     state->_init = true;    
   }
@@ -73,6 +78,8 @@ uint32_t max31856_start(max31856_state_s *const state){
   if(!error){
     /* Pre-mark as running */
     state->_running = true;
+    /* Run the bus at the settings of this device */
+    error |= spi_registerDevice(state->spi, &state->spiDevice);
     /* Write to the configuration registers */
     error |= max31856_writeReg(state, MAX31856_CR0_ADDR, MAX31856_CR0_MASK_CMODE);
     uint8_t CR1_val = (MAX31856_CR1_MASK_TC_K | MAX31856_CR1_MASK_AVG4);
@@ -114,12 +121,12 @@ uint32_t max31856_readReg(max31856_state_s* state, uint8_t addr, uint8_t *result
   if(!state->_init){error|=ERROR_INIT;}
   if(!state->_running){error|= ERROR_STOPPED;}
 
+  /* One transfer, hardware slave select is only held within a single exchange */
+  const uint8_t cmd[2] = {addr, 0x00};
   uint8_t data[2] = {0x00};
-  data[0] = addr;
   if(!error) {
-    error |= spi_readArray(state->spi, state->slaveId, data, 2);
+    error |= spi_transfer(state->spi, state->slaveId, cmd, data, 2);
     *result = data[1];
-
   }
   return error;
 }
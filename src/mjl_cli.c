@@ -0,0 +1,299 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_cli.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Command line over a uart, see mjl_cli.h
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_cli.h"
+#include <stddef.h>
+#include <string.h>
+
+#define CLI_CHAR_BS     ('\b')
+#define CLI_CHAR_DEL    (0x7F)
+
+static uint32_t mjl_cli_edit(MJL_CLI_S *const cli, uint16_t start, uint16_t num);
+static uint32_t mjl_cli_endLine(MJL_CLI_S *const cli, uint16_t len);
+
+const MJL_CLI_CFG_S mjl_cli_cfg_default = {
+  .uart = NULL,
+  .cmds = NULL,
+  .numCmds = 0,
+  .lineBuffer = NULL,
+  .lineBufferLen = 0,
+  .opt_echo = true,
+  .opt_prompt = NULL,
+  .opt_ctx = NULL,
+};
+
+/*******************************************************************************
+* Function Name: mjl_cli_init()
+********************************************************************************
+* \brief
+*   Initializes the CLI state struct from a configuration struct
+*
+* \param cli [in/out]
+* Pointer to the state struct
+*
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_cli_init(MJL_CLI_S *const cli, MJL_CLI_CFG_S *const cfg){
+  uint32_t error = 0;
+  /* Verify required params */
+  error |= (NULL == cfg->uart) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg->cmds) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg->lineBuffer) ? ERROR_POINTER : ERROR_NONE;
+  /* Room for a character and the terminator */
+  if(cfg->lineBufferLen < 2){error|=ERROR_PARAM;}
+  if(!error){
+    cli->uart = cfg->uart;
+    cli->cmds = cfg->cmds;
+    cli->numCmds = cfg->numCmds;
+    cli->lineBuffer = cfg->lineBuffer;
+    cli->lineBufferLen = cfg->lineBufferLen;
+    cli->echo = cfg->opt_echo;
+    cli->prompt = (NULL != cfg->opt_prompt) ? cfg->opt_prompt : MJL_CLI_PROMPT;
+    cli->ctx = cfg->opt_ctx;
+    cli->argv[0] = NULL;
+    cli->argc = 0;
+    cli->_lineLen = 0;
+    cli->_isOverflow = false;
+    cli->_isCr = false;
+    cli->_isPromptDue = true;
+    cli->lastError = 0;
+    cli->linesRun = 0;
+    cli->linesRejected = 0;
+    cli->_init = true;
+  }
+  if(error){cli->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_cli_process()
+********************************************************************************
+* \brief
+*   Handle everything the uart has received, executing each completed line.
+*   Returns at once when nothing has been received. Errors of the commands
+*   are printed and kept in lastError, not returned.
+*
+* \param cli [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the uart
+*******************************************************************************/
+uint32_t mjl_cli_process(MJL_CLI_S *const cli){
+  uint32_t error = 0;
+  if(!cli->_init){error|=ERROR_INIT;}
+  if(!error && cli->_isPromptDue){
+    error |= uart_print(cli->uart, cli->prompt);
+    cli->_isPromptDue = false;
+  }
+  while(!error){
+    /* Read straight into the line, after what has been typed so far. A
+    rejected line is not kept, only read on to find its end */
+    uint16_t start = cli->_isOverflow ? 0 : cli->_lineLen;
+    uint16_t num = 0;
+    /* The spare byte of a full line takes the character ending it */
+    error |= uart_readAvailable(cli->uart, (uint8_t*) &cli->lineBuffer[start], cli->lineBufferLen - start, &num);
+    if(error || (0 == num)){break;}
+    error |= mjl_cli_edit(cli, start, num);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_cli_execute()
+********************************************************************************
+* \brief
+*   Split a line into arguments in place and call the handler of its command.
+*   An empty line does nothing.
+*
+* \param cli [in/out]
+* Pointer to the state struct
+*
+* \param line [in/out]
+* Terminated line, spaces between arguments are replaced by terminators
+*
+* \return
+*  Error code of the handler, ERROR_INVALID for an unknown command and
+*  ERROR_PARAM for more than MJL_CLI_ARGS_MAX arguments
+*******************************************************************************/
+uint32_t mjl_cli_execute(MJL_CLI_S *const cli, char *line){
+  uint32_t error = 0;
+  if(!cli->_init){error|=ERROR_INIT;}
+  if(NULL == line){error|=ERROR_POINTER;}
+  uint8_t argc = 0;
+  char *read = line;
+  while(!error && ('\0' != *read)){
+    /* Skip separators */
+    if((' ' == *read) || ('\t' == *read)){
+      read++;
+      continue;
+    }
+    if(MJL_CLI_ARGS_MAX == argc){
+      error |= ERROR_PARAM;
+      break;
+    }
+    /* A quoted argument runs to the closing quote */
+    bool isQuoted = ('"' == *read);
+    if(isQuoted){read++;}
+    cli->argv[argc++] = read;
+    while(('\0' != *read) && (isQuoted ? ('"' != *read) : ((' ' != *read) && ('\t' != *read)))){
+      read++;
+    }
+    if('\0' != *read){*read++ = '\0';}
+  }
+  cli->argv[argc] = NULL;
+  cli->argc = argc;
+  if(!error && argc){
+    const MJL_CLI_CMD_S *cmd = NULL;
+    for(uint8_t i = 0; i < cli->numCmds; i++){
+      if(0 == strcmp(cli->cmds[i].name, cli->argv[0])){
+        cmd = &cli->cmds[i];
+        break;
+      }
+    }
+    if(NULL == cmd){error|=ERROR_INVALID;}
+    else {
+      cli->linesRun++;
+      error |= cmd->fn((MJL_CLI_T *const) cli, argc, cli->argv);
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_cli_help()
+********************************************************************************
+* \brief
+*   Handler printing every command of the table with its help
+*
+* \param cli [in/out]
+* Pointer to the state struct
+*
+* \param argc [in]
+* Number of arguments, unused
+*
+* \param argv [in]
+* Arguments, unused
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_cli_help(MJL_CLI_T *const cli, uint8_t argc, char *argv[]){
+  uint32_t error = 0;
+  (void) argc;
+  (void) argv;
+  for(uint8_t i = 0; (i < cli->numCmds) && !error; i++){
+    error |= uart_printf(cli->uart, "%s\t%s\r\n", cli->cmds[i].name, (NULL != cli->cmds[i].help) ? cli->cmds[i].help : "");
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_cli_edit()
+********************************************************************************
+* \brief
+*   Apply num characters read into the line buffer at start. Printable
+*   characters stay, backspace removes one, CR, LF or CRLF ends the line and
+*   other control characters are dropped. The line is compacted in place. A
+*   printable character arriving with lineBufferLen - 1 characters already on
+*   the line overflows it.
+*
+* \return
+*  Error code of the uart
+*******************************************************************************/
+static uint32_t mjl_cli_edit(MJL_CLI_S *const cli, uint16_t start, uint16_t num){
+  uint32_t error = 0;
+  char *line = cli->lineBuffer;
+  uint16_t write = start;
+  uint16_t read = start;
+  uint16_t end = start + num;
+  while(read < end){
+    char c = line[read++];
+    bool isLf = ('\n' == c);
+    if(('\r' == c) || isLf){
+      bool isSkipped = isLf && cli->_isCr;
+      cli->_isCr = !isLf;
+      if(!isSkipped){
+        error |= mjl_cli_endLine(cli, write);
+        /* Characters after the end of the line start the next one */
+        end -= read;
+        memmove(line, &line[read], end);
+        read = 0;
+        write = 0;
+      }
+      continue;
+    }
+    cli->_isCr = false;
+    if((CLI_CHAR_BS == c) || (CLI_CHAR_DEL == c)){
+      if(write > 0){
+        write--;
+        if(cli->echo){error |= uart_writeArray(cli->uart, (uint8_t*) "\b \b", 3);}
+      }
+    }
+    else if((uint8_t) c >= ' '){
+      if(write < cli->lineBufferLen - 1){
+        line[write++] = c;
+        if(cli->echo){error |= uart_write(cli->uart, (uint8_t) c);}
+      }
+      else {
+        /* No room for the terminator, reject the line at its end */
+        cli->_isOverflow = true;
+      }
+    }
+  }
+  cli->_lineLen = write;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_cli_endLine()
+********************************************************************************
+* \brief
+*   Execute the len characters of the line buffer, report the result and
+*   print the prompt of the next line
+*
+* \return
+*  Error code of the uart
+*******************************************************************************/
+static uint32_t mjl_cli_endLine(MJL_CLI_S *const cli, uint16_t len){
+  uint32_t error = 0;
+  if(cli->echo){error |= uart_writeArray(cli->uart, (uint8_t*) "\r\n", 2);}
+  cli->lineBuffer[len] = '\0';
+  uint32_t result = 0;
+  if(cli->_isOverflow){
+    result |= ERROR_PARAM;
+    cli->linesRejected++;
+    error |= uart_println(cli->uart, "Line too long");
+  }
+  else {
+    uint32_t linesRun = cli->linesRun;
+    result |= mjl_cli_execute(cli, cli->lineBuffer);
+    if(linesRun != cli->linesRun){
+      if(result){error |= uart_printError(cli->uart, cli->argv[0], result);}
+    }
+    else if(result){
+      /* No handler ran */
+      cli->linesRejected++;
+      if(result & ERROR_INVALID){error |= uart_printf(cli->uart, "Unknown command: %s\r\n", cli->argv[0]);}
+      else {error |= uart_println(cli->uart, "Too many arguments");}
+    }
+  }
+  cli->lastError = result;
+  cli->_isOverflow = false;
+  error |= uart_print(cli->uart, cli->prompt);
+  return error;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,335 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_format.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Number to ASCII conversion without division or floating point
+*   arithmetic, see mjl_format.h
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_format.h"
+#include <stddef.h>
+#include <string.h>
+
+#define FORMAT_HALF   (0x8000000000000000ull)   /* One half of a 64 bit fraction */
+
+/* Two ASCII digits for every value 0-99 */
+static const uint8_t format_pairs[201] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+static const uint8_t format_nibbles[16] = {'0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F'};
+
+static const uint32_t format_pow10[FORMAT_PREC_MAX + 1] = {
+  1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u
+};
+
+static uint8_t format_numDigits(uint32_t val);
+static void format_digits(uint32_t val, uint8_t *end, uint8_t num);
+static uint32_t format_decimal(bool neg, uint32_t whole, uint64_t frac, bool sticky, uint8_t prec, uint8_t *buf, uint8_t *len);
+
+/* val / 100, exact for every uint32_t. Small values stay within 32 bits */
+static inline uint32_t format_div100(uint32_t val){
+  if(val < 43699u){return (val * 5243u) >> 19;}
+  return (uint32_t) (((uint64_t) val * 0x51EB851Fu) >> 37);
+}
+
+/*******************************************************************************
+* Function Name: format_u32()
+********************************************************************************
+* \brief
+*   Write an unsigned integer in decimal
+*
+* \param val [in]
+* Value to format
+*
+* \param buf [out]
+* At least FORMAT_U32_LEN bytes
+*
+* \param len [out]
+* Number of characters written
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t format_u32(uint32_t val, uint8_t *buf, uint8_t *len){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == len)){error|=ERROR_POINTER;}
+  if(!error){
+    uint8_t num = format_numDigits(val);
+    format_digits(val, &buf[num], num);
+    *len = num;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: format_i32()
+********************************************************************************
+* \brief
+*   Write a signed integer in decimal, with a leading '-' when negative
+*
+* \param val [in]
+* Value to format
+*
+* \param buf [out]
+* At least FORMAT_I32_LEN bytes
+*
+* \param len [out]
+* Number of characters written
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t format_i32(int32_t val, uint8_t *buf, uint8_t *len){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == len)){error|=ERROR_POINTER;}
+  if(!error){
+    uint8_t idx = 0;
+    /* Magnitude as unsigned, so INT32_MIN is formatted correctly */
+    uint32_t mag = (uint32_t) val;
+    if(val < 0){
+      buf[idx++] = '-';
+      mag = 0u - mag;
+    }
+    uint8_t num = format_numDigits(mag);
+    format_digits(mag, &buf[idx + num], num);
+    *len = idx + num;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: format_hex32()
+********************************************************************************
+* \brief
+*   Write an unsigned integer in upper case hex, padded to whole bytes
+*
+* \param val [in]
+* Value to format
+*
+* \param buf [out]
+* At least FORMAT_HEX32_LEN bytes
+*
+* \param len [out]
+* Number of characters written, 2 to 8
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t format_hex32(uint32_t val, uint8_t *buf, uint8_t *len){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == len)){error|=ERROR_POINTER;}
+  if(!error){
+    uint8_t num = 2;
+    while((num < FORMAT_HEX32_LEN) && (val >> (4 * num))){
+      num += 2;
+    }
+    for(uint8_t i = num; i > 0; i--){
+      buf[i - 1] = format_nibbles[val & 0xF];
+      val >>= 4;
+    }
+    *len = num;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: format_fixed()
+********************************************************************************
+* \brief
+*   Write a signed fixed point value, e.g. Q16.16, with prec digits after the
+*   decimal point
+*
+* \param val [in]
+* Fixed point value
+*
+* \param fracBits [in]
+* Number of fractional bits in val, 0-31
+*
+* \param prec [in]
+* Digits after the decimal point, 0-FORMAT_PREC_MAX. No point is written for 0
+*
+* \param buf [out]
+* At least FORMAT_FIXED_LEN bytes
+*
+* \param len [out]
+* Number of characters written
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t format_fixed(int32_t val, uint8_t fracBits, uint8_t prec, uint8_t *buf, uint8_t *len){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == len)){error|=ERROR_POINTER;}
+  if((fracBits > 31) || (prec > FORMAT_PREC_MAX)){error|=ERROR_PARAM;}
+  if(!error){
+    uint32_t mag = (val < 0) ? (0u - (uint32_t) val) : (uint32_t) val;
+    uint64_t frac = 0;
+    if(fracBits){
+      frac = ((uint64_t) (mag & ((1u << fracBits) - 1u))) << (64 - fracBits);
+    }
+    error |= format_decimal(val < 0, mag >> fracBits, frac, false, prec, buf, len);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: format_double()
+********************************************************************************
+* \brief
+*   Write a double with prec digits after the decimal point. The value is read
+*   from its IEEE-754 bits and converted in fixed point, no floating point
+*   arithmetic is used. NaN and infinities are written as "NaN", "+inf" and
+*   "-inf".
+*
+* \param val [in]
+* Value to format, magnitude up to FORMAT_FLOAT_MAX
+*
+* \param prec [in]
+* Digits after the decimal point, 0-FORMAT_PREC_MAX. No point is written for 0
+*
+* \param buf [out]
+* At least FORMAT_FIXED_LEN bytes
+*
+* \param len [out]
+* Number of characters written
+*
+* \return
+*  Error code of the operation, ERROR_VAL when the magnitude is too large
+*******************************************************************************/
+uint32_t format_double(double val, uint8_t prec, uint8_t *buf, uint8_t *len){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == len)){error|=ERROR_POINTER;}
+  if(prec > FORMAT_PREC_MAX){error|=ERROR_PARAM;}
+  if(!error){
+    uint64_t bits;
+    memcpy(&bits, &val, sizeof(bits));
+    bool neg = (bits >> 63) != 0;
+    uint32_t exponent = (uint32_t) (bits >> 52) & 0x7FFu;
+    uint64_t mantissa = bits & 0x000FFFFFFFFFFFFFull;
+    uint32_t whole = 0;
+    uint64_t frac = 0;
+    bool sticky = false;
+    const char *special = NULL;
+    /* NaN and infinities */
+    if(0x7FFu == exponent){
+      special = mantissa ? "NaN" : (neg ? "-inf" : "+inf");
+    }
+    /* Subnormals round to zero at any supported precision */
+    else if(0u == exponent){
+      sticky = (mantissa != 0);
+    }
+    else {
+      /* val = mantissa * 2^-shift */
+      mantissa |= 0x0010000000000000ull;
+      uint32_t shift = 1075u - exponent;
+      if((exponent >= 1075u) || (shift < 23u)){error|=ERROR_VAL;}
+      else if(shift < 64u){
+        uint64_t wholeBits = mantissa >> shift;
+        if(wholeBits > FORMAT_FLOAT_MAX){error|=ERROR_VAL;}
+        whole = (uint32_t) wholeBits;
+        frac = mantissa << (64u - shift);
+      }
+      else if(shift < 128u){
+        frac = mantissa >> (shift - 64u);
+        sticky = (0 != (mantissa & ((1ull << (shift - 64u)) - 1u)));
+      }
+      else {
+        sticky = true;
+      }
+    }
+    /* Exactly FORMAT_FLOAT_MAX is allowed, anything above it is not */
+    if((FORMAT_FLOAT_MAX == whole) && (frac || sticky)){error|=ERROR_VAL;}
+    if(error){}
+    else if(NULL != special){
+      uint8_t idx = 0;
+      for(; special[idx] != '\0'; idx++){buf[idx] = (uint8_t) special[idx];}
+      *len = idx;
+    }
+    else {
+      error |= format_decimal(neg, whole, frac, sticky, prec, buf, len);
+    }
+  }
+  return error;
+}
+
+/* Number of decimal digits in val, at least one */
+static uint8_t format_numDigits(uint32_t val){
+  uint8_t num = 1;
+  while((num <= FORMAT_PREC_MAX) && (val >= format_pow10[num])){
+    num++;
+  }
+  return num;
+}
+
+/* Write exactly num digits of val backwards, ending just before end */
+static void format_digits(uint32_t val, uint8_t *end, uint8_t num){
+  while(num >= 2){
+    uint32_t quot = format_div100(val);
+    const uint8_t *pair = &format_pairs[2 * (val - (quot * 100u))];
+    *--end = pair[1];
+    *--end = pair[0];
+    val = quot;
+    num -= 2;
+  }
+  if(num){
+    /* Single digit, val < 10 once the pairs are written */
+    *--end = format_pairs[(2 * val) + 1];
+  }
+}
+
+/*******************************************************************************
+* Function Name: format_decimal()
+********************************************************************************
+* \brief
+*   Round a fixed point magnitude to prec digits and write it. The fraction
+*   is scaled by 2^64, sticky is set when lower bits beyond it are non-zero.
+*   Multiplying by 10^prec uses two 32x32 bit products.
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t format_decimal(bool neg, uint32_t whole, uint64_t frac, bool sticky, uint8_t prec, uint8_t *buf, uint8_t *len){
+  uint32_t scale = format_pow10[prec];
+  /* -0.0 is written without a sign, like uart_printf always has */
+  bool sign = neg && (whole || frac || sticky);
+  uint64_t lo = (frac & 0xFFFFFFFFu) * scale;
+  uint64_t mid = ((frac >> 32) * scale) + (lo >> 32);
+  uint32_t digits = (uint32_t) (mid >> 32);
+  uint64_t rem = (mid << 32) | (lo & 0xFFFFFFFFu);
+  /* Round to nearest, ties to even */
+  bool odd = prec ? (digits & 1u) : (whole & 1u);
+  if((rem > FORMAT_HALF) || ((FORMAT_HALF == rem) && (sticky || odd))){
+    if(prec){digits++;}
+    if(!prec || (digits >= scale)){
+      digits = 0;
+      whole++;
+    }
+  }
+  uint8_t idx = 0;
+  if(sign){buf[idx++] = '-';}
+  uint8_t num = format_numDigits(whole);
+  idx += num;
+  format_digits(whole, &buf[idx], num);
+  if(prec){
+    buf[idx++] = '.';
+    idx += prec;
+    format_digits(digits, &buf[idx], prec);
+  }
+  *len = idx;
+  return 0;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,111 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_log.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Deferred binary logging, see mjl_log.h
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_log.h"
+#include <stddef.h>
+
+/* Provided by the linker for the section holding the format strings */
+extern const char __start_mjl_log[];
+
+/* Keeps the section, and __start_mjl_log, in builds without an MJL_LOG() call */
+static const char mjl_log_anchor[] __attribute__((section("mjl_log"), used)) = "";
+
+const MJL_LOG_CFG_S mjl_log_cfg_default = {
+  .uart = NULL,
+  .opt_getTicks = NULL,
+};
+
+/*******************************************************************************
+* Function Name: mjl_log_init()
+********************************************************************************
+* \brief
+*   Initializes the log state struct from a configuration struct
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_log_init(MJL_LOG_S *const state, MJL_LOG_CFG_S *const cfg){
+  uint32_t error = 0;
+  /* Verify required functions */
+  error |= (NULL == cfg->uart) ? ERROR_POINTER : ERROR_NONE;
+  /* Ticks are not required */
+  if(!error){
+    state->uart = cfg->uart;
+    state->opt_getTicks = cfg->opt_getTicks;
+    state->framesDropped = 0;
+    state->_init = true;
+  }
+  if(error){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_log_write()
+********************************************************************************
+* \brief
+*   Write one frame for a format string in the mjl_log section. Called by
+*   MJL_LOG(), which places the string and converts the arguments.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param fmt [in]
+* Format string in the mjl_log section
+*
+* \param args [in]
+* Arguments as 32 bit words
+*
+* \param num [in]
+* Number of arguments, up to MJL_LOG_ARGS_MAX
+*
+* \return
+*  Error code of the operation, ERROR_PARAM for a string past the first 64 KiB
+*  of the section, whose offset would not fit the frame
+*******************************************************************************/
+uint32_t mjl_log_write(MJL_LOG_S *const state, const char *fmt, const uint32_t *args, uint8_t num){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(num > MJL_LOG_ARGS_MAX){error|=ERROR_PARAM;}
+  /* A string in front of the section wraps to a large offset as well */
+  uintptr_t offset = (uintptr_t) fmt - (uintptr_t) __start_mjl_log;
+  if(offset > UINT16_MAX){error|=ERROR_PARAM;}
+  if(!error){
+    uint8_t frame[MJL_LOG_FRAME_MAX];
+    uint16_t idx = 0;
+    frame[idx++] = (NULL != state->opt_getTicks) ? MJL_LOG_SYNC_TICKS : MJL_LOG_SYNC;
+    frame[idx++] = (uint8_t) offset;
+    frame[idx++] = (uint8_t) (offset >> 8);
+    if(NULL != state->opt_getTicks){
+      uint32_t ticks = state->opt_getTicks();
+      frame[idx++] = (uint8_t) ticks;
+      frame[idx++] = (uint8_t) (ticks >> 8);
+      frame[idx++] = (uint8_t) (ticks >> 16);
+      frame[idx++] = (uint8_t) (ticks >> 24);
+    }
+    for(uint8_t i = 0; i < num; i++){
+      frame[idx++] = (uint8_t) args[i];
+      frame[idx++] = (uint8_t) (args[i] >> 8);
+      frame[idx++] = (uint8_t) (args[i] >> 16);
+      frame[idx++] = (uint8_t) (args[i] >> 24);
+    }
+    error |= uart_writeArray(state->uart, frame, idx);
+    if(error){state->framesDropped++;}
+  }
+  return error;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,200 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_logger.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Leveled logging front end, see mjl_logger.h
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_logger.h"
+#include "mjl_ringTyped.h"
+#include <stddef.h>
+#include <string.h>
+
+/* Prefix of each level in the text sinks */
+static const char *const logger_tags[] = {"", "E: ", "W: ", "I: ", "D: "};
+
+static MJL_LOGGER_SINK_T logger_sink = NULL;
+static void *logger_ctx = NULL;
+MJL_LOG_S *mjl_logger_deferred = NULL;
+
+#ifndef MJL_UART_PRINT_DISABLE
+/* Line of mjl_logger_sinkUart() being formatted */
+typedef struct {
+  MLJ_UART_S *uart;
+  uint8_t buf[MJL_LOGGER_LINE_LEN];
+  uint16_t len;
+} logger_line_s;
+
+static uint32_t logger_lineWrite(void *ctx, const uint8_t *array, uint16_t len);
+#endif
+static uint32_t logger_ringWrite(void *ctx, const uint8_t *array, uint16_t len);
+
+/*******************************************************************************
+* Function Name: mjl_logger_setSink()
+********************************************************************************
+* \brief
+*   Set where enabled log calls are written. NULL discards them.
+*
+* \param sink [in]
+* Sink function, e.g. mjl_logger_sinkUart
+*
+* \param ctx [in/out]
+* Passed to the sink, e.g. the uart
+*******************************************************************************/
+void mjl_logger_setSink(MJL_LOGGER_SINK_T sink, void *ctx){
+  logger_sink = sink;
+  logger_ctx = ctx;
+}
+
+/*******************************************************************************
+* Function Name: mjl_logger_setDeferred()
+********************************************************************************
+* \brief
+*   Set the log of the calls of modules built with MJL_LOGGER_DEFERRED.
+*   NULL discards them.
+*
+* \param log [in/out]
+* Initialized log
+*******************************************************************************/
+void mjl_logger_setDeferred(MJL_LOG_S *log){
+  mjl_logger_deferred = log;
+}
+
+/*******************************************************************************
+* Function Name: mjl_logger_write()
+********************************************************************************
+* \brief
+*   Hand one log call to the sink. Called by the MJL_LOGx() macros.
+*
+* \param level [in]
+* MJL_LOGGER_LEVEL_ERROR to MJL_LOGGER_LEVEL_DEBUG
+*
+* \param fmt [in]
+* Format string, see uart_vformat()
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_logger_write(uint8_t level, const char *fmt, ...){
+  uint32_t error = 0;
+  if(NULL == logger_sink){error|=ERROR_UNAVAILABLE;}
+  if(level > MJL_LOGGER_LEVEL_DEBUG){error|=ERROR_PARAM;}
+  if(!error){
+    va_list args;
+    va_start(args, fmt);
+    error |= logger_sink(logger_ctx, level, fmt, args);
+    va_end(args);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_logger_sinkUart()
+********************************************************************************
+* \brief
+*   Sink writing each call as a line of text out of a started uart. The tag,
+*   the text and the line end are formatted into one buffer and written with
+*   a single uart write, so lines from other contexts can not interleave.
+*   Lines longer than MJL_LOGGER_LINE_LEN take one write per buffer.
+*
+* \param ctx [in/out]
+* MLJ_UART_S to write to
+*
+* \param level [in]
+* Level of the call
+*
+* \param fmt [in]
+* Format string
+*
+* \param args [in]
+* Arguments of the format string
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_logger_sinkUart(void *ctx, uint8_t level, const char *fmt, va_list args){
+  uint32_t error = 0;
+  #ifdef MJL_UART_PRINT_DISABLE
+    /* Nothing to write with */
+    (void) ctx; (void) level; (void) fmt; (void) args;
+    error |= ERROR_UNAVAILABLE;
+  #else
+    logger_line_s line = {.uart = (MLJ_UART_S*) ctx, .len = 0};
+    const char *tag = logger_tags[level];
+    error |= logger_lineWrite(&line, (const uint8_t*) tag, (uint16_t) strlen(tag));
+    error |= uart_vformat(logger_lineWrite, &line, fmt, args);
+    error |= logger_lineWrite(&line, (const uint8_t*) "\r\n", 2);
+    if(!error){error |= uart_writeArray(line.uart, line.buf, line.len);}
+  #endif
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_logger_sinkRing()
+********************************************************************************
+* \brief
+*   Sink writing each call as a line of text into a RAM ring, to be read out
+*   later. In overwrite mode the ring keeps the most recent lines.
+*
+* \param ctx [in/out]
+* Initialized mjl_ring_u8_s
+*
+* \param level [in]
+* Level of the call
+*
+* \param fmt [in]
+* Format string
+*
+* \param args [in]
+* Arguments of the format string
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_logger_sinkRing(void *ctx, uint8_t level, const char *fmt, va_list args){
+  uint32_t error = 0;
+  if(NULL == ctx){error|=ERROR_POINTER;}
+  if(!error){
+    const char *tag = logger_tags[level];
+    error |= logger_ringWrite(ctx, (const uint8_t*) tag, (uint16_t) strlen(tag));
+    error |= uart_vformat(logger_ringWrite, ctx, fmt, args);
+    error |= logger_ringWrite(ctx, (const uint8_t*) "\n", 1);
+  }
+  return error;
+}
+
+#ifndef MJL_UART_PRINT_DISABLE
+/* Writer of mjl_logger_sinkUart(), collects the line and writes it when full */
+static uint32_t logger_lineWrite(void *ctx, const uint8_t *array, uint16_t len){
+  uint32_t error = 0;
+  logger_line_s *line = (logger_line_s*) ctx;
+  while(!error && (len > 0)){
+    if(MJL_LOGGER_LINE_LEN == line->len){
+      error |= uart_writeArray(line->uart, line->buf, line->len);
+      line->len = 0;
+    }
+    uint16_t num = MJL_LOGGER_LINE_LEN - line->len;
+    if(num > len){num = len;}
+    memcpy(&line->buf[line->len], array, num);
+    line->len += num;
+    array += num;
+    len -= num;
+  }
+  return error;
+}
+#endif
+
+/* Writer of uart_vformat() into an mjl_ring_u8_s */
+static uint32_t logger_ringWrite(void *ctx, const uint8_t *array, uint16_t len){
+  uint32_t error = 0;
+  for(uint16_t i = 0; (i < len) && !error; i++){
+    error |= mjl_ring_u8_enqueue((mjl_ring_u8_s*) ctx, array[i]);
+  }
+  return error;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,103 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_metrics.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Runtime counters and gauges of the driver library. Empty unless
+*   MJL_METRICS_ENABLE is defined.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_metrics.h"
+#include "mjl_uart.h"
+
+#ifdef MJL_METRICS_ENABLE
+
+#define METRICS_FRAME_HEADER  (4)   /* Sync bytes, version and count */
+#define METRICS_FRAME_LEN     (METRICS_FRAME_HEADER + (4 * MJL_METRIC_NUM) + 1)
+
+volatile uint32_t mjl_metrics[MJL_METRIC_NUM] = {0};
+
+/*******************************************************************************
+* Function Name: mjl_metrics_get()
+********************************************************************************
+* \brief
+*   Read the current value of one metric
+*
+* \param id [in]
+* Metric to read
+*
+* \param value [out]
+* Current value
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_metrics_get(MJL_METRIC_ID_T id, uint32_t *value){
+  uint32_t error = 0;
+  if(NULL == value){error|=ERROR_POINTER;}
+  if(id >= MJL_METRIC_NUM){error|=ERROR_PARAM;}
+  if(!error){
+    *value = mjl_metrics[id];
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_metrics_reset()
+********************************************************************************
+* \brief
+*   Clear every counter and gauge
+*
+*******************************************************************************/
+void mjl_metrics_reset(void){
+  for(uint16_t i = 0; i < MJL_METRIC_NUM; i++){
+    mjl_metrics[i] = 0;
+  }
+}
+
+/*******************************************************************************
+* Function Name: mjl_metrics_dump()
+********************************************************************************
+* \brief
+*   Write every metric out of the uart as one binary frame, see mjl_metrics.h
+*   for the layout. The values are copied first so the frame is written with
+*   a single call.
+*
+* \param uart [in/out]
+* Started uart
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_metrics_dump(struct MLJ_UART_S *const uart){
+  uint32_t error = 0;
+  if(NULL == uart){error|=ERROR_POINTER;}
+  if(!error){
+    uint8_t frame[METRICS_FRAME_LEN];
+    uint16_t idx = 0;
+    frame[idx++] = MJL_METRICS_SYNC_0;
+    frame[idx++] = MJL_METRICS_SYNC_1;
+    frame[idx++] = MJL_METRICS_VERSION;
+    frame[idx++] = MJL_METRIC_NUM;
+    for(uint16_t i = 0; i < MJL_METRIC_NUM; i++){
+      uint32_t value = mjl_metrics[i];
+      frame[idx++] = (uint8_t) value;
+      frame[idx++] = (uint8_t) (value >> 8);
+      frame[idx++] = (uint8_t) (value >> 16);
+      frame[idx++] = (uint8_t) (value >> 24);
+    }
+    uint8_t checksum = 0;
+    for(uint16_t i = 0; i < idx; i++){
+      checksum += frame[i];
+    }
+    frame[idx++] = checksum;
+    error |= uart_writeArray(uart, frame, idx);
+  }
+  return error;
+}
+
+#endif /* MJL_METRICS_ENABLE */
+/* [] END OF FILE */
@@ -0,0 +1,530 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_parse.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: ASCII to number conversion without division or floating point
+*   arithmetic, see mjl_parse.h
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_parse.h"
+#include <stddef.h>
+#include <string.h>
+
+#define PARSE_U32_DIV10     (429496729u)              /* UINT32_MAX / 10 */
+#define PARSE_FRAC_DEN_MAX  (1000000000u)             /* 10^PARSE_FRAC_DIGITS */
+#define PARSE_HALF          (0x8000000000000000ull)   /* Top bit of a 64 bit mantissa */
+#define PARSE_ROUND_BITS    (40u)                     /* Bits of a 64 bit mantissa below a float mantissa */
+#define PARSE_POW10_MIN     (-64)                     /* Smallest power of parse_pow10 */
+#define PARSE_POW10_MAX     (38)                      /* Largest power of parse_pow10 */
+#define PARSE_EXP_MAX       (100000)                  /* Exponents are clamped here, far outside of float */
+#define PARSE_FLOAT_BIAS    (127)
+#define PARSE_FLOAT_INF     (0x7F800000u)
+#define PARSE_FLOAT_SIGN    (0x80000000u)
+#define PARSE_NEAR_HALF     (8u)                      /* Error bound of a product with an inexact power of ten */
+#define PARSE_BIG_WORDS     (8u)                      /* 32 bit words of a number compared to a halfway point */
+#define PARSE_POW5_13       (1220703125u)             /* 5^13, the largest power of 5 in 32 bits */
+
+/* 10^e for e of PARSE_POW10_MIN to PARSE_POW10_MAX, rounded to 64 bits with
+ * the top bit set. The binary exponent is parse_log2Pow10(e) */
+static const uint64_t parse_pow10[PARSE_POW10_MAX - PARSE_POW10_MIN + 1] = {
+  0xA87FEA27A539E9A5ull, 0xD29FE4B18E88640Full, 0x83A3EEEEF9153E89ull, 0xA48CEAAAB75A8E2Bull,
+  0xCDB02555653131B6ull, 0x808E17555F3EBF12ull, 0xA0B19D2AB70E6ED6ull, 0xC8DE047564D20A8Cull,
+  0xFB158592BE068D2Full, 0x9CED737BB6C4183Dull, 0xC428D05AA4751E4Dull, 0xF53304714D9265E0ull,
+  0x993FE2C6D07B7FACull, 0xBF8FDB78849A5F97ull, 0xEF73D256A5C0F77Dull, 0x95A8637627989AAEull,
+  0xBB127C53B17EC159ull, 0xE9D71B689DDE71B0ull, 0x9226712162AB070Eull, 0xB6B00D69BB55C8D1ull,
+  0xE45C10C42A2B3B06ull, 0x8EB98A7A9A5B04E3ull, 0xB267ED1940F1C61Cull, 0xDF01E85F912E37A3ull,
+  0x8B61313BBABCE2C6ull, 0xAE397D8AA96C1B78ull, 0xD9C7DCED53C72256ull, 0x881CEA14545C7575ull,
+  0xAA242499697392D3ull, 0xD4AD2DBFC3D07788ull, 0x84EC3C97DA624AB5ull, 0xA6274BBDD0FADD62ull,
+  0xCFB11EAD453994BAull, 0x81CEB32C4B43FCF5ull, 0xA2425FF75E14FC32ull, 0xCAD2F7F5359A3B3Eull,
+  0xFD87B5F28300CA0Eull, 0x9E74D1B791E07E48ull, 0xC612062576589DDBull, 0xF79687AED3EEC551ull,
+  0x9ABE14CD44753B53ull, 0xC16D9A0095928A27ull, 0xF1C90080BAF72CB1ull, 0x971DA05074DA7BEFull,
+  0xBCE5086492111AEBull, 0xEC1E4A7DB69561A5ull, 0x9392EE8E921D5D07ull, 0xB877AA3236A4B449ull,
+  0xE69594BEC44DE15Bull, 0x901D7CF73AB0ACD9ull, 0xB424DC35095CD80Full, 0xE12E13424BB40E13ull,
+  0x8CBCCC096F5088CCull, 0xAFEBFF0BCB24AAFFull, 0xDBE6FECEBDEDD5BFull, 0x89705F4136B4A597ull,
+  0xABCC77118461CEFDull, 0xD6BF94D5E57A42BCull, 0x8637BD05AF6C69B6ull, 0xA7C5AC471B478423ull,
+  0xD1B71758E219652Cull, 0x83126E978D4FDF3Bull, 0xA3D70A3D70A3D70Aull, 0xCCCCCCCCCCCCCCCDull,
+  0x8000000000000000ull, 0xA000000000000000ull, 0xC800000000000000ull, 0xFA00000000000000ull,
+  0x9C40000000000000ull, 0xC350000000000000ull, 0xF424000000000000ull, 0x9896800000000000ull,
+  0xBEBC200000000000ull, 0xEE6B280000000000ull, 0x9502F90000000000ull, 0xBA43B74000000000ull,
+  0xE8D4A51000000000ull, 0x9184E72A00000000ull, 0xB5E620F480000000ull, 0xE35FA931A0000000ull,
+  0x8E1BC9BF04000000ull, 0xB1A2BC2EC5000000ull, 0xDE0B6B3A76400000ull, 0x8AC7230489E80000ull,
+  0xAD78EBC5AC620000ull, 0xD8D726B7177A8000ull, 0x878678326EAC9000ull, 0xA968163F0A57B400ull,
+  0xD3C21BCECCEDA100ull, 0x84595161401484A0ull, 0xA56FA5B99019A5C8ull, 0xCECB8F27F4200F3Aull,
+  0x813F3978F8940984ull, 0xA18F07D736B90BE5ull, 0xC9F2C9CD04674EDFull, 0xFC6F7C4045812296ull,
+  0x9DC5ADA82B70B59Eull, 0xC5371912364CE305ull, 0xF684DF56C3E01BC7ull, 0x9A130B963A6C115Cull,
+  0xC097CE7BC90715B3ull, 0xF0BDC21ABB48DB20ull, 0x96769950B50D88F4ull,
+};
+
+static uint32_t parse_digits(const uint8_t *buf, uint16_t len, uint16_t *idx, uint32_t *val);
+static uint32_t parse_round(uint64_t prod, int32_t exp2, uint32_t *lowBits);
+static int8_t parse_compareHalf(uint64_t mant, int32_t exp10, uint32_t lowBits);
+static void parse_bigMulPow5(uint32_t *big, int32_t exp);
+static void parse_bigShift(uint32_t *big, int32_t shift);
+
+/* Value of a decimal digit, 10 or more for anything else */
+static inline uint8_t parse_digit(uint8_t c){
+  return (uint8_t) (c - '0');
+}
+
+/* Top 64 bits of a * b, a lower bit set if any of the rest is */
+static inline uint64_t parse_mulHigh(uint64_t a, uint64_t b){
+  uint64_t lo = (uint64_t) (uint32_t) a * (uint32_t) b;
+  uint64_t mid1 = (a >> 32) * (uint32_t) b;
+  uint64_t mid2 = (uint64_t) (uint32_t) a * (b >> 32);
+  uint64_t mid = (lo >> 32) + (uint32_t) mid1 + (uint32_t) mid2;
+  uint64_t hi = ((a >> 32) * (b >> 32)) + (mid1 >> 32) + (mid2 >> 32) + (mid >> 32);
+  if(((uint32_t) lo) || ((uint32_t) mid)){hi |= 1u;}
+  return hi;
+}
+
+/* floor(log2(10^e)), exact for PARSE_POW10_MIN to PARSE_POW10_MAX */
+static inline int32_t parse_log2Pow10(int32_t e){
+  return (e * 1741647) >> 19;
+}
+
+/*******************************************************************************
+* Function Name: parse_u32()
+********************************************************************************
+* \brief
+*   Read an unsigned decimal integer, with an optional '+'
+*
+* \param buf [in]
+* Characters to read
+*
+* \param len [in]
+* Number of characters
+*
+* \param result [out]
+* Value read
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t parse_u32(const uint8_t *buf, uint16_t len, uint32_t *result){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == result)){error|=ERROR_POINTER;}
+  else if(0 == len){error|=ERROR_UNAVAILABLE;}
+  if(!error){
+    uint16_t idx = ('+' == buf[0]) ? 1 : 0;
+    uint32_t val = 0;
+    error |= parse_digits(buf, len, &idx, &val);
+    if(idx != len){error|=ERROR_VAL;}
+    if(!error){*result = val;}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: parse_i32()
+********************************************************************************
+* \brief
+*   Read a signed decimal integer, with an optional '+' or '-'
+*
+* \param buf [in]
+* Characters to read
+*
+* \param len [in]
+* Number of characters
+*
+* \param result [out]
+* Value read
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t parse_i32(const uint8_t *buf, uint16_t len, int32_t *result){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == result)){error|=ERROR_POINTER;}
+  else if(0 == len){error|=ERROR_UNAVAILABLE;}
+  if(!error){
+    bool neg = ('-' == buf[0]);
+    uint16_t idx = (neg || ('+' == buf[0])) ? 1 : 0;
+    uint32_t mag = 0;
+    error |= parse_digits(buf, len, &idx, &mag);
+    if(idx != len){error|=ERROR_VAL;}
+    if(mag > (neg ? 0x80000000u : 0x7FFFFFFFu)){error|=ERROR_INVALID;}
+    if(!error){*result = (int32_t) (neg ? (0u - mag) : mag);}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: parse_hex32()
+********************************************************************************
+* \brief
+*   Read a hexadecimal integer of up to 32 bits, with an optional "0x" or
+*   "0X". Digits may be upper or lower case.
+*
+* \param buf [in]
+* Characters to read
+*
+* \param len [in]
+* Number of characters
+*
+* \param result [out]
+* Value read
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t parse_hex32(const uint8_t *buf, uint16_t len, uint32_t *result){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == result)){error|=ERROR_POINTER;}
+  else if(0 == len){error|=ERROR_UNAVAILABLE;}
+  if(!error){
+    uint16_t idx = 0;
+    if((len > 2) && ('0' == buf[0]) && (('x' == buf[1]) || ('X' == buf[1]))){idx = 2;}
+    uint32_t val = 0;
+    if(idx == len){error|=ERROR_VAL;}
+    for(; (idx < len) && !(error & ERROR_VAL); idx++){
+      /* Fold lower case onto upper case */
+      uint8_t c = buf[idx];
+      uint8_t nibble = parse_digit(c);
+      if(nibble > 9){
+        nibble = (uint8_t) ((c & ~0x20u) - 'A' + 10u);
+        if((nibble < 10) || (nibble > 15)){error|=ERROR_VAL;}
+      }
+      if(val >> 28){error|=ERROR_INVALID;}
+      val = (val << 4) | nibble;
+    }
+    if(!error){*result = val;}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: parse_fixed()
+********************************************************************************
+* \brief
+*   Read a signed decimal number with an optional fraction, e.g. "-12.375",
+*   into a fixed point value with fracBits fractional bits, e.g. Q16.16. The
+*   fraction is rounded to nearest, ties to even, using the first
+*   PARSE_FRAC_DIGITS fraction digits, later digits only break ties.
+*
+* \param buf [in]
+* Characters to read
+*
+* \param len [in]
+* Number of characters
+*
+* \param fracBits [in]
+* Number of fractional bits of the result, 0-31
+*
+* \param result [out]
+* Fixed point value read
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t parse_fixed(const uint8_t *buf, uint16_t len, uint8_t fracBits, int32_t *result){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == result)){error|=ERROR_POINTER;}
+  else if(0 == len){error|=ERROR_UNAVAILABLE;}
+  if(fracBits > 31){error|=ERROR_PARAM;}
+  if(!error){
+    bool neg = ('-' == buf[0]);
+    uint16_t idx = (neg || ('+' == buf[0])) ? 1 : 0;
+    uint16_t numDigits = 0;
+    uint32_t whole = 0;
+    /* The whole part may be left out, as in ".5" */
+    if((idx < len) && ('.' != buf[idx])){
+      uint16_t first = idx;
+      error |= parse_digits(buf, len, &idx, &whole);
+      numDigits += idx - first;
+    }
+    /* Fraction as num / den, den a power of ten */
+    uint32_t num = 0;
+    uint32_t den = 1;
+    bool sticky = false;
+    if(!(error & ERROR_VAL) && (idx < len) && ('.' == buf[idx])){
+      idx++;
+      for(; (idx < len) && (parse_digit(buf[idx]) <= 9); idx++){
+        uint8_t digit = parse_digit(buf[idx]);
+        numDigits++;
+        if(den < PARSE_FRAC_DEN_MAX){
+          num = (num * 10u) + digit;
+          den *= 10u;
+        }
+        else if(digit){sticky = true;}
+      }
+    }
+    /* At least one digit, nothing after the number */
+    if((idx != len) || (0 == numDigits)){error|=ERROR_VAL;}
+    if(!error){
+      /* Binary digits of the fraction, one more to round with */
+      uint32_t bits = 0;
+      for(uint8_t i = 0; i <= fracBits; i++){
+        num <<= 1;
+        bits <<= 1;
+        if(num >= den){
+          num -= den;
+          bits |= 1u;
+        }
+      }
+      bool isHalf = (bits & 1u);
+      sticky |= (0 != num);
+      uint64_t mag = ((uint64_t) whole << fracBits) + (bits >> 1);
+      if(isHalf && (sticky || (mag & 1u))){mag++;}
+      if(mag > (neg ? 0x80000000u : 0x7FFFFFFFu)){error|=ERROR_INVALID;}
+      else {*result = (int32_t) (neg ? (0u - (uint32_t) mag) : (uint32_t) mag);}
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: parse_float()
+********************************************************************************
+* \brief
+*   Read a decimal number with an optional sign, fraction and exponent, e.g.
+*   "-1.25e-3", into a float. The first PARSE_MANT_DIGITS significant digits
+*   are multiplied by a 64 bit power of ten in integer arithmetic and rounded
+*   to nearest, ties to even. A product near halfway between two floats is
+*   settled by an exact comparison of the digits, so only numbers of more
+*   significant digits within about 2^-60 of halfway may round the other way.
+*   Numbers too small for a float read as 0.
+*
+* \param buf [in]
+* Characters to read
+*
+* \param len [in]
+* Number of characters
+*
+* \param result [out]
+* Value read
+*
+* \return
+*  Error code of the operation, ERROR_INVALID when too large for a float
+*******************************************************************************/
+uint32_t parse_float(const uint8_t *buf, uint16_t len, float *result){
+  uint32_t error = 0;
+  if((NULL == buf) || (NULL == result)){error|=ERROR_POINTER;}
+  else if(0 == len){error|=ERROR_UNAVAILABLE;}
+  if(!error){
+    bool neg = ('-' == buf[0]);
+    uint16_t idx = (neg || ('+' == buf[0])) ? 1 : 0;
+    /* Value is mant * 10^exp10, leading zeros are not significant */
+    uint64_t mant = 0;
+    int32_t exp10 = 0;
+    uint8_t numSig = 0;
+    bool sticky = false;
+    bool isDigit = false;
+    bool isFrac = false;
+    for(; idx < len; idx++){
+      uint8_t digit = parse_digit(buf[idx]);
+      if(digit <= 9){
+        isDigit = true;
+        if((0 == mant) && (0 == digit)){
+          if(isFrac){exp10--;}
+        }
+        else if(numSig < PARSE_MANT_DIGITS){
+          mant = (mant * 10u) + digit;
+          numSig++;
+          if(isFrac){exp10--;}
+        }
+        else {
+          if(!isFrac){exp10++;}
+          if(digit){sticky = true;}
+        }
+      }
+      else if(('.' == buf[idx]) && !isFrac){isFrac = true;}
+      else {break;}
+    }
+    if(!isDigit){error|=ERROR_VAL;}
+    /* Exponent */
+    if(!error && (idx < len) && (('e' == buf[idx]) || ('E' == buf[idx]))){
+      idx++;
+      bool expNeg = (idx < len) && ('-' == buf[idx]);
+      if((idx < len) && (expNeg || ('+' == buf[idx]))){idx++;}
+      int32_t exp = 0;
+      uint16_t expFirst = idx;
+      for(; (idx < len) && (parse_digit(buf[idx]) <= 9); idx++){
+        if(exp < PARSE_EXP_MAX){exp = (exp * 10) + parse_digit(buf[idx]);}
+      }
+      if(expFirst == idx){error|=ERROR_VAL;}
+      exp10 += expNeg ? -exp : exp;
+    }
+    if(idx != len){error|=ERROR_VAL;}
+    uint32_t bits = 0;
+    if(!error && (0 != mant) && (exp10 >= PARSE_POW10_MIN)){
+      if(exp10 > PARSE_POW10_MAX){error|=ERROR_INVALID;}
+      else {
+        /* Mantissa normalized to the top bit, dropped digits kept as a sticky bit */
+        uint8_t lz = (uint8_t) __builtin_clzll(mant);
+        uint64_t norm = mant << lz;
+        if(sticky){norm |= 1u;}
+        /* Value is prod * 2^(exp2 - 63) */
+        uint64_t prod = parse_mulHigh(norm, parse_pow10[exp10 - PARSE_POW10_MIN]);
+        int32_t exp2 = 64 - lz + parse_log2Pow10(exp10);
+        uint32_t lowBits = PARSE_FLOAT_INF;
+        bits = parse_round(prod, exp2, &lowBits);
+        /* Powers below 1 and past 10^27 are inexact, so a product near halfway
+         * may round the wrong way. The digits read settle it against the exact
+         * halfway point, dropped digits put a tie above it */
+        if(PARSE_FLOAT_INF != lowBits){
+          int8_t cmp = parse_compareHalf(mant, exp10, lowBits);
+          bits = ((cmp > 0) || ((0 == cmp) && (sticky || (lowBits & 1u)))) ? (lowBits + 1u) : lowBits;
+        }
+        if(bits >= PARSE_FLOAT_INF){error|=ERROR_INVALID;}
+      }
+    }
+    if(!error){
+      if(neg){bits |= PARSE_FLOAT_SIGN;}
+      memcpy(result, &bits, sizeof(bits));
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: parse_digits()
+********************************************************************************
+* \brief
+*   Accumulate the decimal digits from buf[idx], stopping at the first other
+*   character
+*
+* \return
+*  Error code of the operation, ERROR_VAL without a digit, ERROR_INVALID past
+*  UINT32_MAX
+*******************************************************************************/
+static uint32_t parse_digits(const uint8_t *buf, uint16_t len, uint16_t *idx, uint32_t *val){
+  uint32_t error = 0;
+  uint16_t first = *idx;
+  uint32_t acc = 0;
+  for(; (*idx < len) && (parse_digit(buf[*idx]) <= 9); (*idx)++){
+    uint8_t digit = parse_digit(buf[*idx]);
+    if((acc > PARSE_U32_DIV10) || ((acc == PARSE_U32_DIV10) && (digit > 5))){error|=ERROR_INVALID;}
+    acc = (acc * 10u) + digit;
+  }
+  if(first == *idx){error|=ERROR_VAL;}
+  *val = acc;
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: parse_round()
+********************************************************************************
+* \brief
+*   Round prod * 2^(exp2 - 63) to the nearest float, ties to even
+*
+* \param prod [in]
+* Mantissa with the top bit set, a lower bit set if inexact
+*
+* \param exp2 [in]
+* Binary exponent of the top bit
+*
+* \param lowBits [out]
+* Bits of the float below prod when the bits rounded away are within
+* PARSE_NEAR_HALF of one half, unchanged otherwise
+*
+* \return
+*  Bits of the float without the sign, PARSE_FLOAT_INF or more on overflow
+*******************************************************************************/
+static uint32_t parse_round(uint64_t prod, int32_t exp2, uint32_t *lowBits){
+  if(!(prod & PARSE_HALF)){
+    prod <<= 1;
+    exp2--;
+  }
+  int32_t biased = exp2 + PARSE_FLOAT_BIAS;
+  /* Bits below the float mantissa, more for a subnormal */
+  int32_t shift = PARSE_ROUND_BITS + ((biased < 1) ? (1 - biased) : 0);
+  uint32_t mantF = 0;
+  if(shift <= 64){
+    uint64_t half = 1ull << (shift - 1);
+    uint64_t rem = prod & ((half << 1) - 1u);
+    mantF = (shift < 64) ? (uint32_t) (prod >> shift) : 0u;
+    if(((rem > half) ? (rem - half) : (half - rem)) <= PARSE_NEAR_HALF){
+      *lowBits = (biased < 1) ? mantF : (((uint32_t) (biased - 1) << 23) + mantF);
+    }
+    if((rem > half) || ((rem == half) && (mantF & 1u))){mantF++;}
+  }
+  /* The implicit bit adds one to the exponent, a rounding carry another */
+  return (biased < 1) ? mantF : (((uint32_t) (biased - 1) << 23) + mantF);
+}
+
+/*******************************************************************************
+* Function Name: parse_compareHalf()
+********************************************************************************
+* \brief
+*   Compare mant * 10^exp10 exactly to the halfway point between the float of
+*   lowBits and the next one. Both are integers of up to 256 bits once the
+*   powers of 5 are moved to the side where they are positive.
+*
+* \param mant [in]
+* Significant digits read
+*
+* \param exp10 [in]
+* Decimal exponent of mant, PARSE_POW10_MIN to PARSE_POW10_MAX
+*
+* \param lowBits [in]
+* Bits of the float below the halfway point, without the sign
+*
+* \return
+*  Less than 0 below the halfway point, 0 on it, more than 0 above it
+*******************************************************************************/
+static int8_t parse_compareHalf(uint64_t mant, int32_t exp10, uint32_t lowBits){
+  /* Halfway point is (2m + 1) * 2^exp2, m the mantissa with its implicit bit */
+  uint32_t biased = lowBits >> 23;
+  uint32_t mantF = (lowBits & 0x7FFFFFu) | (biased ? 0x800000u : 0u);
+  int32_t exp2 = (biased ? (int32_t) biased : 1) - PARSE_FLOAT_BIAS - 24;
+  uint32_t num[PARSE_BIG_WORDS] = {(uint32_t) mant, (uint32_t) (mant >> 32)};
+  uint32_t half[PARSE_BIG_WORDS] = {(mantF << 1) + 1u};
+  /* mant * 5^exp10 * 2^exp10 against the halfway point */
+  if(exp10 > 0){parse_bigMulPow5(num, exp10);}
+  else {parse_bigMulPow5(half, -exp10);}
+  if(exp10 > exp2){parse_bigShift(num, exp10 - exp2);}
+  else {parse_bigShift(half, exp2 - exp10);}
+  int8_t cmp = 0;
+  for(int8_t i = PARSE_BIG_WORDS - 1; (i >= 0) && (0 == cmp); i--){
+    if(num[i] != half[i]){cmp = (num[i] > half[i]) ? 1 : -1;}
+  }
+  return cmp;
+}
+
+/*******************************************************************************
+* Function Name: parse_bigMulPow5()
+********************************************************************************
+* \brief
+*   Multiply a number of PARSE_BIG_WORDS words, least significant first, by
+*   5^exp, PARSE_POW5_13 at a time
+*******************************************************************************/
+static void parse_bigMulPow5(uint32_t *big, int32_t exp){
+  while(exp > 0){
+    uint32_t mul = PARSE_POW5_13;
+    if(exp < 13){
+      mul = 1;
+      for(int32_t i = 0; i < exp; i++){mul *= 5u;}
+    }
+    exp -= 13;
+    uint32_t carry = 0;
+    for(uint8_t i = 0; i < PARSE_BIG_WORDS; i++){
+      uint64_t prod = ((uint64_t) big[i] * mul) + carry;
+      big[i] = (uint32_t) prod;
+      carry = (uint32_t) (prod >> 32);
+    }
+  }
+}
+
+/*******************************************************************************
+* Function Name: parse_bigShift()
+********************************************************************************
+* \brief
+*   Shift a number of PARSE_BIG_WORDS words, least significant first, left by
+*   shift bits
+*******************************************************************************/
+static void parse_bigShift(uint32_t *big, int32_t shift){
+  int8_t words = (int8_t) (shift >> 5);
+  uint8_t bits = (uint8_t) (shift & 31);
+  for(int8_t i = PARSE_BIG_WORDS - 1; i >= 0; i--){
+    uint32_t val = 0;
+    if(i >= words){val = big[i - words] << bits;}
+    if(bits && (i > words)){val |= big[i - words - 1] >> (32u - bits);}
+    big[i] = val;
+  }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,191 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringBroadcast.c
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Single producer ring read by any number of independent readers
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_ringBroadcast.h"
+
+/* Default config struct */
+const mjl_ringBroadcast_cfg_s mjl_ringBroadcast_cfg_default = {
+  .buffer = NULL,
+  .size = 0,
+};
+
+/*******************************************************************************
+* Function Name: mjl_ringBroadcast_init()
+********************************************************************************
+* \brief
+*   Initializes the state struct from a configuration struct 
+*
+* \param state [in/out]
+* Pointer to the state struct
+* 
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBroadcast_init(mjl_ringBroadcast_s *const state, mjl_ringBroadcast_cfg_s *const cfg){
+  uint32_t error = 0;
+  /* Verify required pointers */
+  error |= (NULL == state) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg) ? ERROR_POINTER : ERROR_NONE;
+  if(!error){
+    error |= (NULL == cfg->buffer) ? ERROR_POINTER : ERROR_NONE;
+    error |= (!MJL_RING_IS_POW2(cfg->size)) ? ERROR_VAL: ERROR_NONE;
+    error |= (cfg->size < 2) ? ERROR_VAL: ERROR_NONE;
+    error |= (cfg->size > MJL_RING_POW2_SIZE_MAX) ? ERROR_VAL: ERROR_NONE;
+  }
+  /* Valid Inputs */
+  if(!error) {
+    /* Copy params */
+    state->buffer = cfg->buffer;
+    state->mask = cfg->size - 1;
+    /* Set default vals */
+    state->head = 0;
+    /* Mark as initialized */
+    state->_init = true;
+  }
+  if(error && (NULL != state)){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBroadcast_enqueue()
+********************************************************************************
+* \brief
+*   Add an element for all readers. Never blocks, the oldest element is 
+*   overwritten. Must only be called from the producer context.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param in [in]
+* Value to add to the queue 
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBroadcast_enqueue(mjl_ringBroadcast_s *const state, uint32_t in){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    uint32_t head = state->head;
+    state->buffer[head & state->mask] = in;
+    /* Publish the element before the sequence number */
+    MJL_RING_DMB();
+    state->head = head + 1;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBroadcast_attach()
+********************************************************************************
+* \brief
+*   Attach a reader cursor to the ring
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param reader [out]
+* Pointer to the reader cursor
+*
+* \param fromOldest [in]
+* Start at the oldest element still held, otherwise only new elements are read
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBroadcast_attach(mjl_ringBroadcast_s *const state, mjl_ringBroadcast_reader_s *const reader, bool fromOldest){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(NULL == reader){error|=ERROR_POINTER;}
+
+  if(!error){
+    uint32_t head = state->head;
+    reader->seq = head;
+    if(fromOldest){
+      /* The slot at head - size may be rewritten at any time, skip it */
+      reader->seq = (head > state->mask) ? (head - state->mask) : 0;
+    }
+    reader->lost = 0;
+    reader->_init = true;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBroadcast_read()
+********************************************************************************
+* \brief
+*   Read the next element for a reader. If the reader was overrun it skips to 
+*   the oldest valid element and the skipped count is added to reader->lost.
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param reader [in/out]
+* Pointer to the reader cursor
+*
+* \param out [out]
+*  Value read
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBroadcast_read(mjl_ringBroadcast_s *const state, mjl_ringBroadcast_reader_s *const reader, uint32_t *out){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!reader->_init){error|=ERROR_INIT;}
+
+  while(!error){
+    uint32_t head = state->head;
+    if(head == reader->seq){error|=ERROR_STATE; break;}
+    /* Skip ahead when overrun */
+    if((head - reader->seq) > state->mask){
+      reader->lost += (head - reader->seq) - state->mask;
+      reader->seq = head - state->mask;
+    }
+    /* Observe the head before the slot */
+    MJL_RING_DMB();
+    uint32_t val = state->buffer[reader->seq & state->mask];
+    MJL_RING_DMB();
+    /* Retry if the producer lapped the reader during the read */
+    if((state->head - reader->seq) > state->mask){continue;}
+    *out = val;
+    reader->seq++;
+    break;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBroadcast_getAvailable()
+********************************************************************************
+* \brief
+*   Number of elements a reader can still read
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param reader [in]
+* Pointer to the reader cursor
+*
+* \return
+*  Number of elements available
+*******************************************************************************/
+uint16_t mjl_ringBroadcast_getAvailable(mjl_ringBroadcast_s *const state, mjl_ringBroadcast_reader_s *const reader){
+  uint32_t num = state->head - reader->seq;
+  return (num > state->mask) ? state->mask : (uint16_t) num;
+}
+
+/* [] END OF FILE */
@@ -10,6 +10,7 @@
 * 2023.04.27  - Document Created
 ********************************************************************************/
 #include "mjl_ringBuffer.h"
+#include "mjl_metrics.h"
 
 /* Default config struct */
 const mjl_ring_cfg_s mjl_ring_cfg_default = {
@@ -18,6 +19,26 @@ const mjl_ring_cfg_s mjl_ring_cfg_default = {
   .overWrite = false,
 };
 
+/* Advance an index by num elements without a division */
+static inline uint16_t mjl_ringBuffer_advance(uint16_t idx, uint16_t num, uint16_t size){
+  uint32_t next = (uint32_t) idx + num;
+  return (next >= size) ? (uint16_t) (next - size) : (uint16_t) next;
+}
+
+/* SPSC index helpers - indices run over [0, 2*size) */
+static inline uint16_t mjl_ringBuffer_spsc_next(mjl_ring_spsc_s *const state, uint16_t idx){
+  idx++;
+  return (idx == (2 * state->size)) ? 0 : idx;
+}
+
+static inline uint16_t mjl_ringBuffer_spsc_slot(mjl_ring_spsc_s *const state, uint16_t idx){
+  return (idx >= state->size) ? (idx - state->size) : idx;
+}
+
+static inline uint16_t mjl_ringBuffer_spsc_count(mjl_ring_spsc_s *const state, uint16_t head, uint16_t tail){
+  return (head >= tail) ? (head - tail) : ((2 * state->size) - (tail - head));
+}
+
 /*******************************************************************************
 * Function Name: mjl_ringBuffer_init()
 ********************************************************************************
@@ -83,6 +104,7 @@ uint32_t mjl_ringBuffer_enqueue(mjl_ring_s *const state, uint32_t in){
       if(false == state->overWrite){error|=ERROR_STATE;}
       /* Buffer is full, but overwrite*/
       else {
+        MJL_METRIC_INC(MJL_METRIC_RING_OVERWRITES);
         state->buffer[state->head] = in;
         state->head = (state->head + 1) % state->size;
         state->tail = (state->tail + 1) % state->size;
@@ -159,4 +181,379 @@ inline bool mjl_ringBuffer_isBufferFull(mjl_ring_s *const state){
 inline bool mjl_ringBuffer_isBufferEmpty(mjl_ring_s *const state){
   return state->count == 0;
 }
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_peekRead()
+********************************************************************************
+* \brief
+*   Get the queued elements as up to two contiguous regions of the ring storage,
+*   oldest first. The elements stay queued until mjl_ringBuffer_commitRead().
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param first [out]
+*  Region starting at the tail
+*
+* \param second [out]
+*  Wrapped region at the start of the storage, len is 0 if not wrapped
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_peekRead(mjl_ring_s *const state, mjl_ring_span_s *first, mjl_ring_span_s *second){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if((NULL == first) || (NULL == second)){error|=ERROR_POINTER;}
+
+  if(!error){
+    uint16_t toEnd = state->size - state->tail;
+    first->data = &state->buffer[state->tail];
+    first->len = (state->count < toEnd) ? state->count : toEnd;
+    second->data = state->buffer;
+    second->len = state->count - first->len;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_commitRead()
+********************************************************************************
+* \brief
+*   Remove elements consumed in place after mjl_ringBuffer_peekRead()
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param num [in]
+*  Number of elements to remove
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_commitRead(mjl_ring_s *const state, uint16_t num){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(num > state->count){error|=ERROR_VAL;}
+
+  if(!error){
+    state->tail = mjl_ringBuffer_advance(state->tail, num, state->size);
+    state->count -= num;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_peekWrite()
+********************************************************************************
+* \brief
+*   Get the free space as up to two contiguous regions of the ring storage.
+*   Fill them in place, then publish with mjl_ringBuffer_commitWrite().
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param first [out]
+*  Region starting at the head
+*
+* \param second [out]
+*  Wrapped region at the start of the storage, len is 0 if not wrapped
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_peekWrite(mjl_ring_s *const state, mjl_ring_span_s *first, mjl_ring_span_s *second){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if((NULL == first) || (NULL == second)){error|=ERROR_POINTER;}
+
+  if(!error){
+    uint16_t space = state->size - state->count;
+    uint16_t toEnd = state->size - state->head;
+    first->data = &state->buffer[state->head];
+    first->len = (space < toEnd) ? space : toEnd;
+    second->data = state->buffer;
+    second->len = space - first->len;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_commitWrite()
+********************************************************************************
+* \brief
+*   Add elements written in place after mjl_ringBuffer_peekWrite()
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param num [in]
+*  Number of elements to add
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_commitWrite(mjl_ring_s *const state, uint16_t num){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(num > (state->size - state->count)){error|=ERROR_VAL;}
+
+  if(!error){
+    state->head = mjl_ringBuffer_advance(state->head, num, state->size);
+    state->count += num;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_spsc_init()
+********************************************************************************
+* \brief
+*   Initializes a single producer/single consumer ring from a configuration 
+*   struct. Overwrite is not supported, as the producer may not move the tail.
+*
+* \param state [in/out]
+* Pointer to the state struct
+* 
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_spsc_init(mjl_ring_spsc_s *const state, mjl_ring_cfg_s *const cfg){
+  uint32_t error = 0;
+  /* Verify required functions */
+  error |= (NULL == state) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg) ? ERROR_POINTER : ERROR_NONE;
+  if(!error){
+    error |= (NULL == cfg->buffer) ? ERROR_POINTER : ERROR_NONE;
+    error |= (0 == cfg->size) ? ERROR_VAL: ERROR_NONE;
+    error |= (cfg->size > MJL_RING_SPSC_SIZE_MAX) ? ERROR_VAL: ERROR_NONE;
+    error |= (cfg->overWrite) ? ERROR_MODE: ERROR_NONE;
+  }
+  /* Valid Inputs */
+  if(!error) {
+    /* Copy params */
+    state->buffer = cfg->buffer;
+    state->size = cfg->size;
+    /* Set default vals */
+    state->head = 0;
+    state->tail = 0;
+    /* Mark as initialized */
+    state->_init = true;
+  }
+  if(error && (NULL != state)){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_spsc_enqueue()
+********************************************************************************
+* \brief
+*   Add an element to the queue. Must only be called from the producer context 
+*   (e.g. an ISR). Wait-free, and never writes the tail.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param in [in]
+* Value to add to the queue 
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_spsc_enqueue(mjl_ring_spsc_s *const state, uint32_t in){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    uint16_t head = state->head;
+    uint16_t tail = state->tail;
+    if(mjl_ringBuffer_spsc_count(state, head, tail) == state->size){error|=ERROR_STATE;}
+    else {
+      /* Ensure the tail was observed before the slot is reused */
+      MJL_RING_DMB();
+      state->buffer[mjl_ringBuffer_spsc_slot(state, head)] = in;
+      /* Publish the element before the head */
+      MJL_RING_DMB();
+      state->head = mjl_ringBuffer_spsc_next(state, head);
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_spsc_dequeue()
+********************************************************************************
+* \brief
+*   Remove an element from the queue. Must only be called from the consumer 
+*   context (e.g. the main loop). Never writes the head.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param out [out]
+*  Value removed from the queue
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_spsc_dequeue(mjl_ring_spsc_s *const state, uint32_t *out){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    uint16_t tail = state->tail;
+    if(state->head == tail){error|=ERROR_STATE;}
+    else {
+      /* Ensure the head was observed before the slot is read */
+      MJL_RING_DMB();
+      *out = state->buffer[mjl_ringBuffer_spsc_slot(state, tail)];
+      /* Finish reading the slot before handing it back to the producer */
+      MJL_RING_DMB();
+      state->tail = mjl_ringBuffer_spsc_next(state, tail);
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_spsc_getCount()
+********************************************************************************
+* \brief
+*   Number of elements in the queue. Safe to call from either context, the 
+*   result is a snapshot.
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \return
+*  Number of elements in the queue
+*******************************************************************************/
+uint16_t mjl_ringBuffer_spsc_getCount(mjl_ring_spsc_s *const state){
+  return mjl_ringBuffer_spsc_count(state, state->head, state->tail);
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_pow2_init()
+********************************************************************************
+* \brief
+*   Initializes a power of two ring from a configuration struct. The size must 
+*   be a power of two, use MJL_RING_POW2_ASSERT_SIZE() to check at compile time.
+*
+* \param state [in/out]
+* Pointer to the state struct
+* 
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_pow2_init(mjl_ring_pow2_s *const state, mjl_ring_cfg_s *const cfg){
+  uint32_t error = 0;
+  /* Verify required functions */
+  error |= (NULL == state) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg) ? ERROR_POINTER : ERROR_NONE;
+  if(!error){
+    error |= (NULL == cfg->buffer) ? ERROR_POINTER : ERROR_NONE;
+    error |= (!MJL_RING_IS_POW2(cfg->size)) ? ERROR_VAL: ERROR_NONE;
+    error |= (cfg->size > MJL_RING_POW2_SIZE_MAX) ? ERROR_VAL: ERROR_NONE;
+  }
+  /* Valid Inputs */
+  if(!error) {
+    /* Copy params */
+    state->buffer = cfg->buffer;
+    state->mask = cfg->size - 1;
+    state->overWrite = cfg->overWrite;
+    /* Set default vals */
+    state->head = 0;
+    state->tail = 0;
+    /* Mark as initialized */
+    state->_init = true;
+  }
+  if(error && (NULL != state)){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_pow2_enqueue()
+********************************************************************************
+* \brief
+*   Add an element to the queue
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param in [in]
+* Value to add to the queue 
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_pow2_enqueue(mjl_ring_pow2_s *const state, uint32_t in){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    /* Buffer is full */
+    if(mjl_ringBuffer_pow2_getCount(state) > state->mask){
+      if(false == state->overWrite){error|=ERROR_STATE;}
+      /* Drop the oldest element */
+      else {
+        MJL_METRIC_INC(MJL_METRIC_RING_OVERWRITES);
+        state->tail++;
+      }
+    }
+    if(!error){
+      state->buffer[state->head & state->mask] = in;
+      state->head++;
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_pow2_dequeue()
+********************************************************************************
+* \brief
+*   Remove an element from the queue 
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param out [out]
+*  Value removed from the queue
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringBuffer_pow2_dequeue(mjl_ring_pow2_s *const state, uint32_t *out){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(state->head == state->tail){error|=ERROR_STATE;}
+
+  if(!error){
+    *out = state->buffer[state->tail & state->mask];
+    state->tail++;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringBuffer_pow2_getCount()
+********************************************************************************
+* \brief
+*   Number of elements in the queue 
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \return
+*  Number of elements in the queue
+*******************************************************************************/
+uint16_t mjl_ringBuffer_pow2_getCount(mjl_ring_pow2_s *const state){
+  return (uint16_t) (state->head - state->tail);
+}
 /* [] END OF FILE */
\ No newline at end of file
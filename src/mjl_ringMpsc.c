@@ -0,0 +1,189 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringMpsc.c
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Multi-producer/single consumer ring buffer
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_ringMpsc.h"
+
+/* Default config struct */
+const mjl_ringMpsc_cfg_s mjl_ringMpsc_cfg_default = {
+  .buffer = NULL,
+  .size = 0,
+  .fn_criticalEnter = NULL,
+  .fn_criticalExit = NULL,
+};
+
+/*******************************************************************************
+* Function Name: mjl_ringMpsc_claim()
+********************************************************************************
+* \brief
+*   Atomically advance the head from pos to pos+1
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param pos [in]
+* Head observed by the producer
+*
+* \return
+*  True if this producer reserved the slot at pos
+*******************************************************************************/
+static bool mjl_ringMpsc_claim(mjl_ringMpsc_s *const state, uint32_t pos){
+  bool isClaimed = false;
+  #if MJL_RING_HAS_EXCLUSIVE
+    /* Compiles to an LDREX/STREX sequence on Cortex-M3/M4 */
+    if(NULL == state->fn_criticalEnter){
+      return __atomic_compare_exchange_n(&state->head, &pos, pos + 1, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    }
+  #endif
+  uint32_t intState = state->fn_criticalEnter();
+  if(state->head == pos){
+    state->head = pos + 1;
+    isClaimed = true;
+  }
+  state->fn_criticalExit(intState);
+  return isClaimed;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringMpsc_init()
+********************************************************************************
+* \brief
+*   Initializes the state struct from a configuration struct 
+*
+* \param state [in/out]
+* Pointer to the state struct
+* 
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringMpsc_init(mjl_ringMpsc_s *const state, mjl_ringMpsc_cfg_s *const cfg){
+  uint32_t error = 0;
+  /* Verify required pointers */
+  error |= (NULL == state) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg) ? ERROR_POINTER : ERROR_NONE;
+  if(!error){
+    error |= (NULL == cfg->buffer) ? ERROR_POINTER : ERROR_NONE;
+    error |= (!MJL_RING_IS_POW2(cfg->size)) ? ERROR_VAL: ERROR_NONE;
+    error |= (cfg->size > MJL_RING_POW2_SIZE_MAX) ? ERROR_VAL: ERROR_NONE;
+    /* Critical section hooks come as a pair, and are required without LDREX/STREX */
+    error |= ((NULL == cfg->fn_criticalEnter) != (NULL == cfg->fn_criticalExit)) ? ERROR_POINTER : ERROR_NONE;
+    error |= (!MJL_RING_HAS_EXCLUSIVE && (NULL == cfg->fn_criticalEnter)) ? ERROR_POINTER : ERROR_NONE;
+  }
+  /* Valid Inputs */
+  if(!error) {
+    /* Copy params */
+    state->buffer = cfg->buffer;
+    state->mask = cfg->size - 1;
+    state->fn_criticalEnter = cfg->fn_criticalEnter;
+    state->fn_criticalExit = cfg->fn_criticalExit;
+    /* Set default vals - each slot is free for the producer of its index */
+    for(uint32_t i=0; i<cfg->size; i++){
+      state->buffer[i].seq = i;
+    }
+    state->head = 0;
+    state->tail = 0;
+    MJL_RING_DMB();
+    /* Mark as initialized */
+    state->_init = true;
+  }
+  if(error && (NULL != state)){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringMpsc_enqueue()
+********************************************************************************
+* \brief
+*   Add an element to the queue. Safe to call from any number of producer 
+*   contexts, including nested interrupts.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param in [in]
+* Value to add to the queue 
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringMpsc_enqueue(mjl_ringMpsc_s *const state, uint32_t in){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    mjl_ringMpsc_slot_s *slot = NULL;
+    uint32_t pos = state->head;
+    while(true){
+      slot = &state->buffer[pos & state->mask];
+      int32_t dif = (int32_t) (slot->seq - pos);
+      MJL_RING_DMB();
+      /* Slot is free for this position, try to reserve it */
+      if(0 == dif){
+        if(mjl_ringMpsc_claim(state, pos)){break;}
+      }
+      /* Slot still holds an unread element */
+      else if(dif < 0){
+        error|=ERROR_STATE;
+        break;
+      }
+      /* Another producer moved the head */
+      pos = state->head;
+    }
+    if(!error){
+      slot->value = in;
+      /* Publish the value before committing the slot */
+      MJL_RING_DMB();
+      slot->seq = pos + 1;
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringMpsc_dequeue()
+********************************************************************************
+* \brief
+*   Remove an element from the queue. Must only be called from the consumer 
+*   context. Reports empty while the oldest reserved slot is still being filled.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param out [out]
+*  Value removed from the queue
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringMpsc_dequeue(mjl_ringMpsc_s *const state, uint32_t *out){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    uint32_t pos = state->tail;
+    mjl_ringMpsc_slot_s *slot = &state->buffer[pos & state->mask];
+    if((int32_t) (slot->seq - (pos + 1)) < 0){error|=ERROR_STATE;}
+    else {
+      /* Observe the commit before the value */
+      MJL_RING_DMB();
+      *out = slot->value;
+      /* Finish reading before freeing the slot for the next lap */
+      MJL_RING_DMB();
+      slot->seq = pos + state->mask + 1;
+      state->tail = pos + 1;
+    }
+  }
+  return error;
+}
+
+/* [] END OF FILE */
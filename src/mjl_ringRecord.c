@@ -0,0 +1,253 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringRecord.c
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Variable length record queue
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_ringRecord.h"
+#include <string.h>
+
+/* Default config struct */
+const mjl_ringRecord_cfg_s mjl_ringRecord_cfg_default = {
+  .buffer = NULL,
+  .size = 0,
+};
+
+/* Length prefix access, byte wise as records are not aligned */
+static inline uint16_t mjl_ringRecord_getHeader(mjl_ringRecord_s *const state, uint16_t offset){
+  return (uint16_t) state->buffer[offset] | ((uint16_t) state->buffer[offset + 1] << 8);
+}
+
+static inline void mjl_ringRecord_setHeader(mjl_ringRecord_s *const state, uint16_t offset, uint16_t len){
+  state->buffer[offset] = (uint8_t) len;
+  state->buffer[offset + 1] = (uint8_t) (len >> 8);
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringRecord_init()
+********************************************************************************
+* \brief
+*   Initializes the state struct from a configuration struct 
+*
+* \param state [in/out]
+* Pointer to the state struct
+* 
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringRecord_init(mjl_ringRecord_s *const state, mjl_ringRecord_cfg_s *const cfg){
+  uint32_t error = 0;
+  /* Verify required pointers */
+  error |= (NULL == state) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg) ? ERROR_POINTER : ERROR_NONE;
+  if(!error){
+    error |= (NULL == cfg->buffer) ? ERROR_POINTER : ERROR_NONE;
+    error |= (cfg->size <= MJL_RING_RECORD_HEADER_LEN) ? ERROR_VAL: ERROR_NONE;
+  }
+  /* Valid Inputs */
+  if(!error) {
+    /* Copy params */
+    state->buffer = cfg->buffer;
+    state->size = cfg->size;
+    /* Set default vals */
+    state->head = 0;
+    state->tail = 0;
+    state->reserveOffset = 0;
+    state->reserveLen = 0;
+    state->isReserved = false;
+    /* Mark as initialized */
+    state->_init = true;
+  }
+  if(error && (NULL != state)){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringRecord_reserve()
+********************************************************************************
+* \brief
+*   Reserve contiguous space for a record. The payload is filled in place and 
+*   published with mjl_ringRecord_commit(). A new reservation replaces an 
+*   uncommitted one.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param len [in]
+* Maximum payload length of the record
+*
+* \param payload [out]
+* Pointer to the reserved payload
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringRecord_reserve(mjl_ringRecord_s *const state, uint16_t len, uint8_t **payload){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(len > MJL_RING_RECORD_LEN_MAX){error|=ERROR_VAL;}
+  else if(((uint32_t) len + MJL_RING_RECORD_HEADER_LEN) >= state->size){error|=ERROR_VAL;}
+
+  if(!error){
+    uint16_t head = state->head;
+    uint16_t tail = state->tail;
+    uint16_t need = len + MJL_RING_RECORD_HEADER_LEN;
+    /* Head must never land on the tail, that reads as empty */
+    if(head >= tail){
+      uint16_t toEnd = state->size - head;
+      if((need < toEnd) || ((need == toEnd) && (0 != tail))){state->reserveOffset = head;}
+      else if(need < tail){state->reserveOffset = 0;}
+      else {error|=ERROR_STATE;}
+    }
+    else if(need < (tail - head)){state->reserveOffset = head;}
+    else {error|=ERROR_STATE;}
+  }
+  if(!error){
+    state->reserveLen = len;
+    state->isReserved = true;
+    *payload = &state->buffer[state->reserveOffset + MJL_RING_RECORD_HEADER_LEN];
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringRecord_commit()
+********************************************************************************
+* \brief
+*   Publish the reserved record to the reader
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param len [in]
+* Payload length written, no more than the reserved length
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringRecord_commit(mjl_ringRecord_s *const state, uint16_t len){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(!state->isReserved){error|=ERROR_STATE;}
+  else if(len > state->reserveLen){error|=ERROR_VAL;}
+
+  if(!error){
+    uint16_t head = state->head;
+    uint16_t offset = state->reserveOffset;
+    /* Mark the skipped end of the storage, too short an end is skipped implicitly */
+    if((offset != head) && ((state->size - head) >= MJL_RING_RECORD_HEADER_LEN)){
+      mjl_ringRecord_setHeader(state, head, MJL_RING_RECORD_WRAP);
+    }
+    mjl_ringRecord_setHeader(state, offset, len);
+    uint32_t next = (uint32_t) offset + MJL_RING_RECORD_HEADER_LEN + len;
+    /* Publish the record before the head */
+    MJL_RING_DMB();
+    state->head = (next == state->size) ? 0 : (uint16_t) next;
+    state->isReserved = false;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringRecord_write()
+********************************************************************************
+* \brief
+*   Copy a complete record into the queue
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param data [in]
+* Record payload
+*
+* \param len [in]
+* Payload length
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringRecord_write(mjl_ringRecord_s *const state, const uint8_t *data, uint16_t len){
+  uint8_t *payload = NULL;
+  uint32_t error = mjl_ringRecord_reserve(state, len, &payload);
+  if(!error){
+    memcpy(payload, data, len);
+    error |= mjl_ringRecord_commit(state, len);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringRecord_peek()
+********************************************************************************
+* \brief
+*   Get the oldest record in place. It stays queued until 
+*   mjl_ringRecord_release().
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param payload [out]
+* Pointer to the record payload
+*
+* \param len [out]
+* Payload length
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringRecord_peek(mjl_ringRecord_s *const state, uint8_t **payload, uint16_t *len){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  while(!error){
+    uint16_t tail = state->tail;
+    if(state->head == tail){error|=ERROR_STATE; break;}
+    /* Observe the head before the record */
+    MJL_RING_DMB();
+    /* Writer continued at the start of the storage */
+    if(((state->size - tail) < MJL_RING_RECORD_HEADER_LEN) || 
+      (MJL_RING_RECORD_WRAP == mjl_ringRecord_getHeader(state, tail))){
+      state->tail = 0;
+      continue;
+    }
+    *len = mjl_ringRecord_getHeader(state, tail);
+    *payload = &state->buffer[tail + MJL_RING_RECORD_HEADER_LEN];
+    break;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringRecord_release()
+********************************************************************************
+* \brief
+*   Remove the record returned by mjl_ringRecord_peek()
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringRecord_release(mjl_ringRecord_s *const state){
+  uint8_t *payload = NULL;
+  uint16_t len = 0;
+  uint32_t error = mjl_ringRecord_peek(state, &payload, &len);
+  if(!error){
+    uint32_t next = (uint32_t) state->tail + MJL_RING_RECORD_HEADER_LEN + len;
+    /* Finish reading the record before handing the space back */
+    MJL_RING_DMB();
+    state->tail = (next == state->size) ? 0 : (uint16_t) next;
+  }
+  return error;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,302 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringStats.c
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Windowed statistics over the contents of a ring buffer
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_ringStats.h"
+
+/* Default config struct */
+const mjl_ringStats_cfg_s mjl_ringStats_cfg_default = {
+  .ring = NULL,
+  .minBuffer = NULL,
+  .maxBuffer = NULL,
+};
+
+/* Index of the n-th deque entry after head */
+static inline uint16_t mjl_ringStats_idx(mjl_ringStats_s *const state, uint16_t head, uint16_t n){
+  uint32_t idx = (uint32_t) head + n;
+  return (idx >= state->ring->size) ? (uint16_t) (idx - state->ring->size) : (uint16_t) idx;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_push()
+********************************************************************************
+* \brief
+*   Add a new element to the back of both deques, dropping entries that can no
+*   longer be the min (or max) of the window
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param in [in]
+* Value of the new element
+*
+* \return
+*  None
+*******************************************************************************/
+static void mjl_ringStats_push(mjl_ringStats_s *const state, uint32_t in){
+  /* Min deque holds increasing values */
+  while((state->minCount > 0) && 
+    (state->minBuffer[mjl_ringStats_idx(state, state->minHead, state->minCount-1)].value >= in)){
+    state->minCount--;
+  }
+  mjl_ringStats_entry_s *minEntry = &state->minBuffer[mjl_ringStats_idx(state, state->minHead, state->minCount++)];
+  minEntry->value = in;
+  minEntry->seq = state->seqHead;
+  /* Max deque holds decreasing values */
+  while((state->maxCount > 0) && 
+    (state->maxBuffer[mjl_ringStats_idx(state, state->maxHead, state->maxCount-1)].value <= in)){
+    state->maxCount--;
+  }
+  mjl_ringStats_entry_s *maxEntry = &state->maxBuffer[mjl_ringStats_idx(state, state->maxHead, state->maxCount++)];
+  maxEntry->value = in;
+  maxEntry->seq = state->seqHead;
+  state->sum += in;
+  state->seqHead++;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_pop()
+********************************************************************************
+* \brief
+*   Remove the oldest element from the window
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param out [in]
+* Value of the removed element
+*
+* \return
+*  None
+*******************************************************************************/
+static void mjl_ringStats_pop(mjl_ringStats_s *const state, uint32_t out){
+  if((state->minCount > 0) && (state->minBuffer[state->minHead].seq == state->seqTail)){
+    state->minHead = mjl_ringStats_idx(state, state->minHead, 1);
+    state->minCount--;
+  }
+  if((state->maxCount > 0) && (state->maxBuffer[state->maxHead].seq == state->seqTail)){
+    state->maxHead = mjl_ringStats_idx(state, state->maxHead, 1);
+    state->maxCount--;
+  }
+  state->sum -= out;
+  state->seqTail++;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_init()
+********************************************************************************
+* \brief
+*   Initializes the state struct from a configuration struct. Any elements 
+*   already in the ring are added to the statistics.
+*
+* \param state [in/out]
+* Pointer to the state struct
+* 
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringStats_init(mjl_ringStats_s *const state, mjl_ringStats_cfg_s *const cfg){
+  uint32_t error = 0;
+  /* Verify required pointers */
+  error |= (NULL == state) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg) ? ERROR_POINTER : ERROR_NONE;
+  if(!error){
+    error |= (NULL == cfg->ring) ? ERROR_POINTER : ERROR_NONE;
+    error |= (NULL == cfg->minBuffer) ? ERROR_POINTER : ERROR_NONE;
+    error |= (NULL == cfg->maxBuffer) ? ERROR_POINTER : ERROR_NONE;
+  }
+  if(!error && !cfg->ring->_init){error|=ERROR_INIT;}
+  /* Valid Inputs */
+  if(!error) {
+    /* Copy params */
+    state->ring = cfg->ring;
+    state->minBuffer = cfg->minBuffer;
+    state->maxBuffer = cfg->maxBuffer;
+    /* Set default vals */
+    state->minHead = 0;
+    state->minCount = 0;
+    state->maxHead = 0;
+    state->maxCount = 0;
+    state->sum = 0;
+    state->seqHead = 0;
+    state->seqTail = 0;
+    /* Seed from the current contents */
+    mjl_ring_span_s spans[2];
+    error |= mjl_ringBuffer_peekRead(state->ring, &spans[0], &spans[1]);
+    for(uint8_t s=0; (s<2) && !error; s++){
+      for(uint16_t i=0; i<spans[s].len; i++){
+        mjl_ringStats_push(state, spans[s].data[i]);
+      }
+    }
+    /* Mark as initialized */
+    state->_init = !error;
+  }
+  if(error && (NULL != state)){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_enqueue()
+********************************************************************************
+* \brief
+*   Add an element to the ring and the statistics. When the ring is full and 
+*   in overwrite mode the oldest element leaves the window.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param in [in]
+* Value to add to the queue 
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringStats_enqueue(mjl_ringStats_s *const state, uint32_t in){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    mjl_ring_s *ring = state->ring;
+    bool isEvicting = mjl_ringBuffer_isBufferFull(ring) && ring->overWrite;
+    uint32_t oldest = isEvicting ? ring->buffer[ring->tail] : 0;
+    error |= mjl_ringBuffer_enqueue(ring, in);
+    if(!error){
+      if(isEvicting){mjl_ringStats_pop(state, oldest);}
+      mjl_ringStats_push(state, in);
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_dequeue()
+********************************************************************************
+* \brief
+*   Remove the oldest element from the ring and the statistics
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param out [out]
+*  Value removed from the queue
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringStats_dequeue(mjl_ringStats_s *const state, uint32_t *out){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    error |= mjl_ringBuffer_dequeue(state->ring, out);
+    if(!error){mjl_ringStats_pop(state, *out);}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_getMin()
+********************************************************************************
+* \brief
+*   Smallest element in the window
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param min [out]
+*  Minimum value
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringStats_getMin(mjl_ringStats_s *const state, uint32_t *min){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(0 == state->minCount){error|=ERROR_STATE;}
+
+  if(!error){*min = state->minBuffer[state->minHead].value;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_getMax()
+********************************************************************************
+* \brief
+*   Largest element in the window
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param max [out]
+*  Maximum value
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringStats_getMax(mjl_ringStats_s *const state, uint32_t *max){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(0 == state->maxCount){error|=ERROR_STATE;}
+
+  if(!error){*max = state->maxBuffer[state->maxHead].value;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_getSum()
+********************************************************************************
+* \brief
+*   Sum of the elements in the window
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param sum [out]
+*  Sum of the window
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringStats_getSum(mjl_ringStats_s *const state, uint64_t *sum){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){*sum = state->sum;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringStats_getMean()
+********************************************************************************
+* \brief
+*   Mean of the elements in the window, truncated to an integer
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param mean [out]
+*  Mean of the window
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringStats_getMean(mjl_ringStats_s *const state, uint32_t *mean){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(mjl_ringBuffer_isBufferEmpty(state->ring)){error|=ERROR_STATE;}
+
+  if(!error){*mean = (uint32_t) (state->sum / state->ring->count);}
+  return error;
+}
+
+/* [] END OF FILE */
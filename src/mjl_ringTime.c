@@ -0,0 +1,256 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringTime.c
+* Workspace: MJL Driver Library 
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: History ring of timestamped samples
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_ringTime.h"
+
+/* Default config struct */
+const mjl_ringTime_cfg_s mjl_ringTime_cfg_default = {
+  .buffer = NULL,
+  .size = 0,
+};
+
+/* Sample at a logical index, 0 is the oldest */
+static inline mjl_ringTime_sample_s * mjl_ringTime_at(mjl_ringTime_s *const state, uint16_t idx){
+  uint32_t pos = (uint32_t) state->tail + idx;
+  return &state->buffer[(pos >= state->size) ? (pos - state->size) : pos];
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringTime_bound()
+********************************************************************************
+* \brief
+*   Binary search for the first sample at or after a time (or strictly after,
+*   for the upper bound). Times are compared as offsets from the oldest sample
+*   so that wrapping timestamps order correctly.
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param time [in]
+* Time to search for
+*
+* \param isUpper [in]
+* Find the first sample strictly after the time
+*
+* \return
+*  Logical index of the sample, count if there is none
+*******************************************************************************/
+static uint16_t mjl_ringTime_bound(mjl_ringTime_s *const state, uint32_t time, bool isUpper){
+  if(0 == state->count){return 0;}
+  uint32_t oldest = mjl_ringTime_at(state, 0)->time;
+  /* Before the history */
+  if((int32_t) (time - oldest) < 0){return 0;}
+  uint32_t key = time - oldest;
+  uint16_t lo = 0;
+  uint16_t hi = state->count;
+  while(lo < hi){
+    uint16_t mid = lo + ((hi - lo) >> 1);
+    uint32_t offset = mjl_ringTime_at(state, mid)->time - oldest;
+    if(isUpper ? (offset <= key) : (offset < key)){lo = mid + 1;}
+    else {hi = mid;}
+  }
+  return lo;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringTime_init()
+********************************************************************************
+* \brief
+*   Initializes the state struct from a configuration struct 
+*
+* \param state [in/out]
+* Pointer to the state struct
+* 
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringTime_init(mjl_ringTime_s *const state, mjl_ringTime_cfg_s *const cfg){
+  uint32_t error = 0;
+  /* Verify required pointers */
+  error |= (NULL == state) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg) ? ERROR_POINTER : ERROR_NONE;
+  if(!error){
+    error |= (NULL == cfg->buffer) ? ERROR_POINTER : ERROR_NONE;
+    error |= (0 == cfg->size) ? ERROR_VAL: ERROR_NONE;
+  }
+  /* Valid Inputs */
+  if(!error) {
+    /* Copy params */
+    state->buffer = cfg->buffer;
+    state->size = cfg->size;
+    /* Set default vals */
+    state->head = 0;
+    state->tail = 0;
+    state->count = 0;
+    /* Mark as initialized */
+    state->_init = true;
+  }
+  if(error && (NULL != state)){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringTime_enqueue()
+********************************************************************************
+* \brief
+*   Add a sample to the history, overwriting the oldest when full
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param time [in]
+* Timestamp of the sample, must not be earlier than the newest sample
+*
+* \param value [in]
+* Value of the sample
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringTime_enqueue(mjl_ringTime_s *const state, uint32_t time, uint32_t value){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if((state->count > 0) && ((int32_t) (time - mjl_ringTime_at(state, state->count - 1)->time) < 0)){
+    error|=ERROR_VAL;
+  }
+
+  if(!error){
+    state->buffer[state->head].time = time;
+    state->buffer[state->head].value = value;
+    state->head = (state->head + 1 == state->size) ? 0 : state->head + 1;
+    if(state->count == state->size){
+      state->tail = state->head;
+    }
+    else {state->count++;}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringTime_get()
+********************************************************************************
+* \brief
+*   Get a sample by logical index
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param idx [in]
+* Index of the sample, 0 is the oldest
+*
+* \param sample [out]
+* Copy of the sample
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringTime_get(mjl_ringTime_s *const state, uint16_t idx, mjl_ringTime_sample_s *sample){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  else if(idx >= state->count){error|=ERROR_VAL;}
+
+  if(!error){*sample = *mjl_ringTime_at(state, idx);}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringTime_findTime()
+********************************************************************************
+* \brief
+*   Find the first sample at or after a time in O(log N)
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param time [in]
+* Time to search for
+*
+* \param idx [out]
+* Logical index of the sample
+*
+* \return
+*  Error code of the operation, ERROR_UNAVAILABLE if all samples are earlier
+*******************************************************************************/
+uint32_t mjl_ringTime_findTime(mjl_ringTime_s *const state, uint32_t time, uint16_t *idx){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error){
+    *idx = mjl_ringTime_bound(state, time, false);
+    if(*idx == state->count){error|=ERROR_UNAVAILABLE;}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_ringTime_decimate()
+********************************************************************************
+* \brief
+*   Pick up to num evenly spaced samples with timeStart <= time <= timeEnd, 
+*   e.g. one per graph column. Costs O(log N + num).
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param timeStart [in]
+* Start of the window
+*
+* \param timeEnd [in]
+* End of the window, inclusive
+*
+* \param out [out]
+* Array of at least num samples
+*
+* \param num [in]
+* Maximum number of samples to output
+*
+* \param numOut [out]
+* Number of samples placed in out
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_ringTime_decimate(mjl_ringTime_s *const state, uint32_t timeStart, uint32_t timeEnd, mjl_ringTime_sample_s *out, uint16_t num, uint16_t *numOut){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if((NULL == out) || (NULL == numOut)){error|=ERROR_POINTER;}
+  if((int32_t) (timeEnd - timeStart) < 0){error|=ERROR_VAL;}
+
+  if(!error){
+    uint16_t first = mjl_ringTime_bound(state, timeStart, false);
+    uint16_t end = mjl_ringTime_bound(state, timeEnd, true);
+    uint16_t span = (end > first) ? (end - first) : 0;
+    uint16_t outLen = (span < num) ? span : num;
+    if(outLen > 0){
+      /* Step through the span with an integer accumulator, one division total */
+      uint16_t step = span / outLen;
+      uint16_t rem = span - (step * outLen);
+      uint16_t acc = 0;
+      uint16_t idx = first;
+      for(uint16_t i=0; i<outLen; i++){
+        out[i] = *mjl_ringTime_at(state, idx);
+        idx += step;
+        acc += rem;
+        if(acc >= outLen){
+          acc -= outLen;
+          idx++;
+        }
+      }
+    }
+    *numOut = outLen;
+  }
+  return error;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,19 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_ringTyped.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Library provided instantiations of the typed ring buffers
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_ringTyped.h"
+
+MJL_RING_TYPED_DEFINE(mjl_ring_u8, uint8_t)
+MJL_RING_TYPED_DEFINE(mjl_ring_i16, int16_t)
+MJL_RING_TYPED_DEFINE(mjl_ring_u16, uint16_t)
+MJL_RING_TYPED_DEFINE(mjl_ring_f32, float)
+
+/* [] END OF FILE */
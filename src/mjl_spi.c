@@ -12,10 +12,12 @@
 ********************************************************************************/
 #include "mjl_spi.h"
 #include "mjl_errors.h"
+#include "mjl_metrics.h"
 
 const MJL_SPI_CFG_S spi_cfg_default = {
   .req_hal_writeArray_blocking = NULL,
   .req_hal_read = NULL,
+  .opt_hal_readArray = NULL,
   .req_hal_setActive = NULL,
   .req_hal_getRxBufferNum = NULL,
   .req_hal_getTxBufferNum = NULL,
@@ -23,8 +25,39 @@ const MJL_SPI_CFG_S spi_cfg_default = {
   .req_hal_clearTxBuffer = NULL,
   .opt_hal_externalStart = NULL,
   .opt_hal_externalStop = NULL,
+  .opt_hal_setIrq = NULL,
+  .opt_hal_csAssert = NULL,
+  .opt_hal_csDeassert = NULL,
+  .opt_hal_configure = NULL,
+  .opt_hal_getTicks = NULL,
+  .opt_hal_dmaStart = NULL,
+  .opt_hal_dmaAbort = NULL,
+  .opt_hal_criticalEnter = NULL,
+  .opt_hal_criticalExit = NULL,
+  .opt_fifoDepth = 0,
+  .opt_chunkLen = 0,
+  .opt_dmaMinLen = 0,
 };
 
+/* Sent in place of a NULL tx buffer */
+static const uint8_t spi_dummy[MJL_SPI_FIFO_DEPTH_DEFAULT] = {0};
+
+static uint32_t spi_abortQueue(MJL_SPI_S *const state);
+static uint32_t spi_fillTx(MJL_SPI_S *const state, MJL_SPI_XFER_S *const xfer);
+static MJL_SPI_XFER_S *spi_startNext(MJL_SPI_S *const state);
+static uint32_t spi_setIrq(MJL_SPI_S *const state, bool enable);
+static uint32_t spi_dmaStart(MJL_SPI_S *const state, MJL_SPI_XFER_S *const xfer);
+static void spi_dmaComplete(MJL_DMA_DESC_S *const desc, uint32_t error);
+static uint32_t spi_criticalEnter(MJL_SPI_S *const state);
+static void spi_criticalExit(MJL_SPI_S *const state, uint32_t intState);
+static uint32_t spi_writeChunk(MJL_SPI_S *const state, const uint8_t *tx, uint16_t num);
+static uint32_t spi_readChunk(MJL_SPI_S *const state, uint8_t *rx, uint16_t num);
+static uint32_t spi_select(MJL_SPI_S *const state, uint8_t id);
+static uint32_t spi_activateDevice(MJL_SPI_S *const state, uint8_t id);
+static bool spi_isDeviceValid(MJL_SPI_S *const state, uint8_t id);
+static void spi_deselect(MJL_SPI_S *const state);
+static uint32_t spi_exchange(MJL_SPI_S *const state, const uint8_t *tx, uint8_t *rx, uint16_t len);
+
 /*******************************************************************************
 * Function Name: spi_init()
 ********************************************************************************
@@ -52,11 +85,17 @@ uint32_t spi_init(MJL_SPI_S *const state, MJL_SPI_CFG_S *const cfg){
   error |= (NULL == cfg->req_hal_clearTxBuffer) ? ERROR_POINTER : ERROR_NONE;
   error |= (NULL == cfg->opt_hal_externalStart) ? ERROR_POINTER : ERROR_NONE;
   error |= (NULL == cfg->opt_hal_externalStop) ? ERROR_POINTER : ERROR_NONE;
+  /* The DMA completion interrupt shares the queue with the SPI interrupt */
+  if(NULL != cfg->opt_hal_dmaStart){
+    error |= (NULL == cfg->opt_hal_criticalEnter) ? ERROR_POINTER : ERROR_NONE;
+    error |= (NULL == cfg->opt_hal_criticalExit) ? ERROR_POINTER : ERROR_NONE;
+  }
   /* Valid Inputs */
   if(!error) {
     /* Copy params */
     state->req_hal_writeArray_blocking = cfg->req_hal_writeArray_blocking; 
     state->req_hal_read = cfg->req_hal_read; 
+    state->opt_hal_readArray = cfg->opt_hal_readArray;
     state->req_hal_setActive = cfg->req_hal_setActive; 
     state->req_hal_getRxBufferNum = cfg->req_hal_getRxBufferNum; 
     state->req_hal_getTxBufferNum = cfg->req_hal_getTxBufferNum; 
@@ -64,6 +103,32 @@ uint32_t spi_init(MJL_SPI_S *const state, MJL_SPI_CFG_S *const cfg){
     state->req_hal_clearTxBuffer = cfg->req_hal_clearTxBuffer; 
     state->opt_hal_externalStart = cfg->opt_hal_externalStart; 
     state->opt_hal_externalStop = cfg->opt_hal_externalStop; 
+    state->opt_hal_setIrq = cfg->opt_hal_setIrq;
+    state->opt_hal_csAssert = cfg->opt_hal_csAssert;
+    state->opt_hal_csDeassert = cfg->opt_hal_csDeassert;
+    state->opt_hal_configure = cfg->opt_hal_configure;
+    /* No devices registered */
+    state->numDevices = 0;
+    state->_activeDevice = NULL;
+    state->opt_hal_getTicks = cfg->opt_hal_getTicks;
+    state->fifoDepth = (0 == cfg->opt_fifoDepth) ? MJL_SPI_FIFO_DEPTH_DEFAULT : cfg->opt_fifoDepth;
+    state->chunkLen = cfg->opt_chunkLen;
+    state->opt_hal_dmaStart = cfg->opt_hal_dmaStart;
+    state->opt_hal_dmaAbort = cfg->opt_hal_dmaAbort;
+    state->opt_hal_criticalEnter = cfg->opt_hal_criticalEnter;
+    state->opt_hal_criticalExit = cfg->opt_hal_criticalExit;
+    state->dmaMinLen = (0 == cfg->opt_dmaMinLen) ? MJL_SPI_DMA_MIN_LEN_DEFAULT : cfg->opt_dmaMinLen;
+    state->_dma._busy = false;
+    /* Empty transaction queues */
+    for(uint8_t i = 0; i < MJL_SPI_PRIORITY_NUM; i++){
+      state->_queueHead[i] = NULL;
+      state->_queueTail[i] = NULL;
+      state->maxWaitTicks[i] = 0;
+    }
+    state->_active = NULL;
+    state->_irqEnabled = false;
+    state->_inService = false;
+    state->_reService = false;
     /* Mark as initialized */
     state->_init = true;
     state->_running = false;
@@ -118,62 +183,84 @@ uint32_t spi_stop(MJL_SPI_S *const state){
   if(!state->_running){error|=ERROR_STOPPED;}
 
   if(!error){
+    /* Return any queued transactions to their owners, they can not requeue once stopped */
+    state->_running = false;
+    error |= spi_abortQueue(state);
     /* Run the external start function if present  */
     if(NULL != state->opt_hal_externalStop){
       error |= state->opt_hal_externalStop((MJL_SPI_T *const) state);
     }
-    state->_running = false;
   }
   return error;
 }
 
 /*******************************************************************************
-* Function Name: spi_writeArray_blocking()
+* Function Name: spi_registerDevice()
 ********************************************************************************
 * \brief
-*   Write an array of data out via the SPI port
+*   Register the bus settings of a slave. Before each transaction with a 
+*   registered slave the settings are applied through opt_hal_configure, only 
+*   when they differ from the device last used, so every slave runs at its 
+*   own maximum clock. Once a slave is registered, transactions with a slave
+*   that is not return ERROR_PARAM, as they would run with the mode and clock
+*   of whichever device was used last. Register every slave of a shared bus.
+*   Without opt_hal_configure or registered slaves the bus is used as it is.
+*   Registering the same descriptor again has no effect.
 *
 * \param state [in/out]
 * Pointer to the state struct
 *
+* \param device [in]
+* Descriptor of the slave, must stay valid while registered
+*
 * \return
 *  Error code of the operation
 *******************************************************************************/
-uint32_t spi_writeArray_blocking(MJL_SPI_S *const state, uint8_t id, uint8_t * array, uint16_t len){
+uint32_t spi_registerDevice(MJL_SPI_S *const state, const MJL_SPI_DEVICE_S *device){
   uint32_t error = 0;
+  bool isRegistered = false;
   if(!state->_init){error|=ERROR_INIT;}
-  if(!state->_running){error|=ERROR_STOPPED;}
+  if(NULL == device){error|=ERROR_POINTER;}
+  else if(0 == device->maxClockHz){error|=ERROR_VAL;}
+  else if(device->mode > MJL_SPI_MODE_3){error|=ERROR_MODE;}
 
   if(!error){
-    /* Select the slave */
-    error|= state->req_hal_setActive(id); 
-    /* Place the data in the TX buffer*/
-    error|= state->req_hal_writeArray_blocking(array, len);
-    /* Wait until TX buffer is clear */    
-    uint32_t txNum = len;
-    do{
-      txNum = state->req_hal_getTxBufferNum();
-      // TODO: Add timeout
-    }
-    while(txNum > 0);
-    /* Wait for RX buffer to populate */
-    uint32_t rxNum = 0;
-    do{
-      rxNum = state->req_hal_getRxBufferNum();
-      // TODO: Add timeout
+    for(uint8_t i = 0; i < state->numDevices; i++){
+      if(state->devices[i] == device){isRegistered = true;}
+      /* One descriptor per slave */
+      else if(state->devices[i]->id == device->id){error|=ERROR_VAL;}
     }
-    while(rxNum < len);
-    /* Clear the dummy data in the RX Buffer */
-    error|= state->req_hal_clearRxBuffer();
+    if(!isRegistered && (state->numDevices >= MJL_SPI_DEVICE_MAX)){error|=ERROR_UNAVAILABLE;}
+  }
+  if(!error && !isRegistered){
+    state->devices[state->numDevices++] = device;
   }
   return error;
 }
 
+/*******************************************************************************
+* Function Name: spi_writeArray_blocking()
+********************************************************************************
+* \brief
+*   Write an array of data out via the SPI port, discarding the received bytes
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_writeArray_blocking(MJL_SPI_S *const state, uint8_t id, uint8_t * array, uint16_t len){
+  return spi_transfer(state, id, array, NULL, len);
+}
+
 /*******************************************************************************
 * Function Name: spi_readArray()
 ********************************************************************************
 * \brief
-*   Read data from the SPI port
+*   Read data from the SPI port. The contents of array are sent (dummy bytes 
+*   or command bytes) and replaced in place by the received bytes. Prefer 
+*   spi_transfer() with separate buffers.
 *
 * \param state [in/out]
 * Pointer to the state struct
@@ -182,27 +269,256 @@ uint32_t spi_writeArray_blocking(MJL_SPI_S *const state, uint8_t id, uint8_t * a
 *  Error code of the operation
 *******************************************************************************/
 uint32_t spi_readArray(MJL_SPI_S *const state,  uint8_t id, uint8_t * array, uint16_t len){
+  return spi_transfer(state, id, array, array, len);
+}
+
+/*******************************************************************************
+* Function Name: spi_transfer()
+********************************************************************************
+* \brief
+*   Full duplex exchange of len bytes with a slave. The TX FIFO is kept topped 
+*   up while the RX FIFO is drained, with at most fifoDepth bytes in flight, 
+*   so transfers of any length neither stall nor overflow the RX FIFO.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param id [in]
+* Slave ID to select
+*
+* \param tx [in]
+* Data to send, NULL sends dummy bytes (0)
+*
+* \param rx [out]
+* Received data, NULL discards it. May be the same buffer as tx
+*
+* \param len [in]
+* Number of bytes to exchange
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_transfer(MJL_SPI_S *const state, uint8_t id, const uint8_t *tx, uint8_t *rx, uint16_t len){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!state->_running){error|=ERROR_STOPPED;}
+  if(!spi_isDeviceValid(state, id)){error|=ERROR_PARAM;}
+  /* The bus belongs to the transaction queue until it drains */
+  if(!spi_isQueueIdle(state)){error|=ERROR_STATE;}
+
+  if(!error){
+    error |= spi_select(state, id);
+    error |= spi_exchange(state, tx, rx, len);
+    spi_deselect(state);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_transferSegments()
+********************************************************************************
+* \brief
+*   Run a list of segments (command, address, data, read...) as one bus 
+*   transaction. Each segment is exchanged as with spi_transfer(), and its 
+*   fn_before hook runs once the previous segment has fully shifted. The chip 
+*   select is held across segments by opt_hal_csAssert/opt_hal_csDeassert, 
+*   without them a hardware slave select may release between segments.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param id [in]
+* Slave ID to select
+*
+* \param segs [in/out]
+* Array of segments, exchanged in order
+*
+* \param num [in]
+* Number of segments
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_transferSegments(MJL_SPI_S *const state, uint8_t id, const MJL_SPI_SEG_S *segs, uint8_t num){
   uint32_t error = 0;
   if(!state->_init){error|=ERROR_INIT;}
   if(!state->_running){error|=ERROR_STOPPED;}
+  if(NULL == segs){error|=ERROR_POINTER;}
+  if(!spi_isDeviceValid(state, id)){error|=ERROR_PARAM;}
+  /* The bus belongs to the transaction queue until it drains */
+  if(!spi_isQueueIdle(state)){error|=ERROR_STATE;}
 
   if(!error){
-    /* Clear the receive buffer */
-    error|= state->req_hal_clearRxBuffer();
-    /* Select the slave */
-    error|= state->req_hal_setActive(id); 
-    /* Write out the number of bytes wish to be read - These can be dummy bytes (0), or command bytes */
-    error|= state->req_hal_writeArray_blocking(array, len);
-    /* Place the data from the RX Buffer into the results buffer */
-    uint32_t val = 0;
-    do{
-      val = state->req_hal_getRxBufferNum();
-      // TODO: add timeout
+    error |= spi_select(state, id);
+    for(uint8_t i = 0; (i < num) && !error; i++){
+      if(NULL != segs[i].fn_before){
+        segs[i].fn_before(segs[i].arg);
+      }
+      error |= spi_exchange(state, segs[i].tx, segs[i].rx, segs[i].len);
+    }
+    spi_deselect(state);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_select()
+********************************************************************************
+* \brief
+*   Select a slave at the start of a blocking transaction and discard stale
+*   received data
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param id [in]
+* Slave ID to select
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t spi_select(MJL_SPI_S *const state, uint8_t id){
+  uint32_t error = 0;
+  MJL_METRIC_INC(MJL_METRIC_SPI_TRANSACTIONS);
+  error |= spi_activateDevice(state, id);
+  error |= state->req_hal_setActive(id);
+  if(NULL != state->opt_hal_csAssert){
+    error |= state->opt_hal_csAssert(id);
+  }
+  error |= state->req_hal_clearRxBuffer();
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_activateDevice()
+********************************************************************************
+* \brief
+*   Apply the bus settings of a registered slave if they are not already 
+*   active. The bus is idle whenever a transaction starts.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param id [in]
+* Slave ID about to be selected
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t spi_activateDevice(MJL_SPI_S *const state, uint8_t id){
+  uint32_t error = 0;
+  if((NULL != state->opt_hal_configure) && ((NULL == state->_activeDevice) || (state->_activeDevice->id != id))){
+    for(uint8_t i = 0; i < state->numDevices; i++){
+      if(state->devices[i]->id == id){
+        error |= state->opt_hal_configure(state->devices[i]);
+        /* Retry on the next transaction if the HAL refused */
+        state->_activeDevice = error ? NULL : state->devices[i];
+        break;
+      }
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_isDeviceValid()
+********************************************************************************
+* \brief
+*   Check that a slave may be selected. With opt_hal_configure and registered
+*   slaves only those are, any other would inherit the settings of the last.
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param id [in]
+* Slave ID to check
+*
+* \return
+*  True if the slave may be selected
+*******************************************************************************/
+static bool spi_isDeviceValid(MJL_SPI_S *const state, uint8_t id){
+  bool isValid = (NULL == state->opt_hal_configure) || (0 == state->numDevices);
+  for(uint8_t i = 0; !isValid && (i < state->numDevices); i++){
+    if(state->devices[i]->id == id){isValid = true;}
+  }
+  return isValid;
+}
+
+/*******************************************************************************
+* Function Name: spi_deselect()
+********************************************************************************
+* \brief
+*   Release a software chip select at the end of a blocking transaction
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+*******************************************************************************/
+static void spi_deselect(MJL_SPI_S *const state){
+  if(NULL != state->opt_hal_csDeassert){
+    state->opt_hal_csDeassert();
+  }
+}
+
+/*******************************************************************************
+* Function Name: spi_exchange()
+********************************************************************************
+* \brief
+*   Exchange len bytes with the selected slave. The TX FIFO is kept topped up 
+*   while the RX FIFO is drained, with at most fifoDepth bytes in flight. 
+*   Returns once every byte has been received, or gives up when no byte moves
+*   for MJL_SPI_STALL_MAX polls, e.g. a stopped SCB clock, and clears both
+*   FIFOs.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param tx [in]
+* Data to send or NULL
+*
+* \param rx [out]
+* Destination or NULL
+*
+* \param len [in]
+* Number of bytes to exchange
+*
+* \return
+*  Error code of the operation, ERROR_TIMEOUT if the FIFOs stopped moving
+*******************************************************************************/
+static uint32_t spi_exchange(MJL_SPI_S *const state, const uint8_t *tx, uint8_t *rx, uint16_t len){
+  uint32_t error = 0;
+  uint16_t txIdx = 0;
+  uint16_t rxIdx = 0;
+  uint32_t stalls = 0;
+  MJL_METRIC_ADD(MJL_METRIC_SPI_BYTES, len);
+  while(rxIdx < len){
+    /* Top up the TX FIFO */
+    uint16_t num = len - txIdx;
+    uint16_t space = state->fifoDepth - (txIdx - rxIdx);
+    if(num > space){num = space;}
+    if(num > 0){
+      error |= spi_writeChunk(state, (NULL == tx) ? NULL : &tx[txIdx], num);
+      txIdx += num;
+    }
+    /* Collect what has been clocked in */
+    uint32_t rxNum = state->req_hal_getRxBufferNum();
+    if(rxNum > (uint32_t) (txIdx - rxIdx)){rxNum = txIdx - rxIdx;}
+    if(rxNum > 0){
+      error |= spi_readChunk(state, (NULL == rx) ? NULL : &rx[rxIdx], rxNum);
+      rxIdx += rxNum;
+    }
+    /* Polled while the FIFOs were still busy */
+    if((0 == num) && (0 == rxNum)){
+      MJL_METRIC_INC(MJL_METRIC_SPI_SPINS);
+      if(++stalls >= MJL_SPI_STALL_MAX){
+        error|=ERROR_TIMEOUT;
+        state->req_hal_clearTxBuffer();
+        state->req_hal_clearRxBuffer();
+        break;
+      }
     }
-    while(val < len);
-    /* Retrieve the data from the buffer */
-    for(uint16_t i=0; i < len; i++){
-      error|= state->req_hal_read(&array[i]);
+    else {
+      stalls = 0;
     }
   }
   return error;
@@ -240,4 +556,529 @@ uint32_t spi_read(MJL_SPI_S *const state,  uint8_t id, uint8_t * data){
   return spi_readArray(state, id, data, 1);
 }
 
+/*******************************************************************************
+* Function Name: spi_queueTransfer()
+********************************************************************************
+* \brief
+*   Queue a transaction without waiting for it. The transaction is serviced by
+*   spi_serviceQueue() from the SPI interrupt (opt_hal_setIrq) or by polling,
+*   and xfer->fn_complete is called once all len bytes have been exchanged.
+*   The xfer struct and its buffers must stay valid until then.
+*
+*   Call from thread context, or from an interrupt of the same priority as the
+*   SPI interrupt.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param xfer [in/out]
+* Transaction to queue
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_queueTransfer(MJL_SPI_S *const state, MJL_SPI_XFER_S *const xfer){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!state->_running){error|=ERROR_STOPPED;}
+  if(NULL == xfer){error|=ERROR_POINTER;}
+  else if(0 == xfer->len){error|=ERROR_VAL;}
+  else if(xfer->priority >= MJL_SPI_PRIORITY_NUM){error|=ERROR_VAL;}
+  else if(xfer->_busy){error|=ERROR_RUNNING;}
+  else if(!spi_isDeviceValid(state, xfer->id)){error|=ERROR_PARAM;}
+
+  if(!error){
+    xfer->_busy = true;
+    xfer->_txIdx = 0;
+    xfer->_rxIdx = 0;
+    xfer->_chunkEnd = 0;
+    xfer->_error = 0;
+    xfer->_next = NULL;
+    if(NULL != state->opt_hal_getTicks){
+      xfer->_queuedTicks = state->opt_hal_getTicks();
+    }
+    /* Keep the SPI and DMA interrupts out while the list is modified */
+    error |= spi_setIrq(state, false);
+    uint32_t intState = spi_criticalEnter(state);
+    uint8_t prio = xfer->priority;
+    if(NULL == state->_queueHead[prio]){
+      state->_queueHead[prio] = xfer;
+    } else {
+      state->_queueTail[prio]->_next = xfer;
+    }
+    state->_queueTail[prio] = xfer;
+    bool isIdle = (NULL == state->_active) && !state->_inService;
+    spi_criticalExit(state, intState);
+    /* Start an idle bus. From a completion callback the running service loop picks it up */
+    if(isIdle){
+      error |= spi_serviceQueue(state);
+    }
+    error |= spi_setIrq(state, !spi_isQueueIdle(state) && !state->_dma._busy);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_serviceQueue()
+********************************************************************************
+* \brief
+*   Move received bytes out of the RX FIFO and top up the TX FIFO for the
+*   active transaction, completing and starting transactions as they finish.
+*   Call from the SPI interrupt, or poll it when no interrupt is configured.
+*   At most fifoDepth bytes are in flight, so the RX FIFO can not overflow.
+*   High priority transactions start ahead of low priority ones, and
+*   splittable low priority transactions release the bus every chunkLen bytes
+*   so a waiting high priority transaction only waits for one chunk.
+*   Chunks of at least dmaMinLen bytes are handed to opt_hal_dmaStart, the
+*   SPI interrupt stays off while they run and the DMA completion interrupt
+*   services the queue instead. A call while the queue is already being
+*   serviced makes the running call loop once more.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_serviceQueue(MJL_SPI_S *const state){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!state->_running){error|=ERROR_STOPPED;}
+
+  bool isPass = false;
+  if(!error){
+    /* Only one context services the queue, a nested call requests another pass */
+    uint32_t intState = spi_criticalEnter(state);
+    isPass = !state->_inService;
+    state->_inService = true;
+    state->_reService = !isPass;
+    spi_criticalExit(state, intState);
+  }
+  bool isOwner = isPass;
+  while(isPass){
+    while(true){
+      /* Between transfers or chunks, high priority goes first */
+      MJL_SPI_XFER_S *xfer = state->_active;
+      if(NULL == xfer){
+        xfer = spi_startNext(state);
+        if(NULL == xfer){break;}
+      }
+      /* The DMA owns the FIFOs until its completion */
+      if(state->_dma._busy){break;}
+      /* Collect the bytes clocked in so far */
+      uint32_t rxNum = state->req_hal_getRxBufferNum();
+      if(rxNum > (uint32_t) (xfer->_txIdx - xfer->_rxIdx)){rxNum = xfer->_txIdx - xfer->_rxIdx;}
+      if(rxNum > 0){
+        xfer->_error |= spi_readChunk(state, (NULL == xfer->rx) ? NULL : &xfer->rx[xfer->_rxIdx], rxNum);
+        xfer->_rxIdx += rxNum;
+      }
+      /* Refill what was received */
+      xfer->_error |= spi_fillTx(state, xfer);
+      /* Still on the wire, wait for the next interrupt */
+      if(xfer->_rxIdx < xfer->_chunkEnd){break;}
+      /* Chunk done, release the bus */
+      spi_deselect(state);
+      state->_active = NULL;
+      if(xfer->_rxIdx < xfer->len){continue;}
+      /* Retire before the callback so it can queue the next transaction */
+      uint8_t prio = xfer->priority;
+      state->_queueHead[prio] = xfer->_next;
+      if(NULL == state->_queueHead[prio]){
+        state->_queueTail[prio] = NULL;
+      }
+      xfer->_busy = false;
+      if(NULL != xfer->fn_complete){
+        xfer->fn_complete(xfer, xfer->_error);
+      }
+      error |= xfer->_error;
+    }
+    /* Leave unless an interrupt asked for another pass meanwhile */
+    uint32_t intState = spi_criticalEnter(state);
+    isPass = state->_reService;
+    state->_reService = false;
+    if(!isPass){state->_inService = false;}
+    spi_criticalExit(state, intState);
+  }
+  if(isOwner){
+    /* Interrupt while the CPU moves bytes, off when idle or the DMA runs */
+    error |= spi_setIrq(state, !spi_isQueueIdle(state) && !state->_dma._busy);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_startNext()
+********************************************************************************
+* \brief
+*   Select the slave of the next transaction, or next chunk of a split 
+*   transaction, giving high priority transactions the bus first. Records how
+*   long a transaction waited for its first byte.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Transaction now active, NULL if the queues are empty
+*******************************************************************************/
+static MJL_SPI_XFER_S *spi_startNext(MJL_SPI_S *const state){
+  MJL_SPI_XFER_S *xfer = state->_queueHead[MJL_SPI_PRIORITY_HIGH];
+  if(NULL == xfer){
+    xfer = state->_queueHead[MJL_SPI_PRIORITY_LOW];
+  }
+  if(NULL != xfer){
+    /* Latency from queueing to the first byte */
+    if((0 == xfer->_txIdx) && (NULL != state->opt_hal_getTicks)){
+      uint32_t wait = state->opt_hal_getTicks() - xfer->_queuedTicks;
+      if(wait > state->maxWaitTicks[xfer->priority]){
+        state->maxWaitTicks[xfer->priority] = wait;
+      }
+      MJL_METRIC_MAX(MJL_METRIC_SPI_WAIT_MAX, wait);
+    }
+    /* Only splittable low priority transfers are chunked */
+    uint16_t chunk = xfer->len - xfer->_rxIdx;
+    bool isChunked = (MJL_SPI_PRIORITY_LOW == xfer->priority) && xfer->isSplittable && (0 != state->chunkLen);
+    if(isChunked && (chunk > state->chunkLen)){
+      chunk = state->chunkLen;
+    }
+    xfer->_chunkEnd = xfer->_rxIdx + chunk;
+    MJL_METRIC_ADD(MJL_METRIC_SPI_BYTES, chunk);
+    xfer->_error |= spi_select(state, xfer->id);
+    state->_active = xfer;
+    /* Long chunks move without the CPU */
+    if((NULL != state->opt_hal_dmaStart) && (chunk >= state->dmaMinLen)){
+      xfer->_error |= spi_dmaStart(state, xfer);
+    }
+  }
+  return xfer;
+}
+
+/*******************************************************************************
+* Function Name: spi_dmaStart()
+********************************************************************************
+* \brief
+*   Hand the current chunk of a transaction to the DMA. On failure the chunk 
+*   is left to the CPU.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param xfer [in/out]
+* Active transaction, at the start of a chunk
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t spi_dmaStart(MJL_SPI_S *const state, MJL_SPI_XFER_S *const xfer){
+  uint32_t error = 0;
+  MJL_DMA_DESC_S *desc = &state->_dma;
+  desc->tx = (NULL == xfer->tx) ? NULL : &xfer->tx[xfer->_rxIdx];
+  desc->rx = (NULL == xfer->rx) ? NULL : &xfer->rx[xfer->_rxIdx];
+  desc->len = xfer->_chunkEnd - xfer->_rxIdx;
+  desc->fn_complete = spi_dmaComplete;
+  desc->context = state;
+  desc->_busy = true;
+  /* Every byte of the chunk is in flight */
+  xfer->_txIdx = xfer->_chunkEnd;
+  error |= state->opt_hal_dmaStart(desc);
+  if(error){
+    desc->_busy = false;
+    xfer->_txIdx = xfer->_rxIdx;
+  } else {
+    MJL_METRIC_ADD(MJL_METRIC_SPI_DMA_BYTES, desc->len);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_dmaComplete()
+********************************************************************************
+* \brief
+*   DMA completion callback, runs in the DMA interrupt. Marks the chunk as 
+*   received and services the queue.
+*
+* \param desc [in/out]
+* Descriptor of the finished transfer
+*
+* \param error [in]
+* Error code reported by the HAL
+*******************************************************************************/
+static void spi_dmaComplete(MJL_DMA_DESC_S *const desc, uint32_t error){
+  MJL_SPI_S *const state = (MJL_SPI_S *) desc->context;
+  MJL_SPI_XFER_S *xfer = state->_active;
+  if(NULL != xfer){
+    xfer->_rxIdx = xfer->_chunkEnd;
+    xfer->_error |= error;
+  }
+  (void) spi_serviceQueue(state);
+}
+
+/*******************************************************************************
+* Function Name: spi_setIrq()
+********************************************************************************
+* \brief
+*   Enable or disable the SPI interrupt through opt_hal_setIrq, only when the
+*   setting changes
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param enable [in]
+* True to enable the interrupt
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t spi_setIrq(MJL_SPI_S *const state, bool enable){
+  uint32_t error = 0;
+  if((NULL != state->opt_hal_setIrq) && (enable != state->_irqEnabled)){
+    state->_irqEnabled = enable;
+    error |= state->opt_hal_setIrq(enable);
+  }
+  return error;
+}
+
+/* Critical section around the queue bookkeeping, empty without the hooks */
+static uint32_t spi_criticalEnter(MJL_SPI_S *const state){
+  return (NULL == state->opt_hal_criticalEnter) ? 0 : state->opt_hal_criticalEnter();
+}
+
+static void spi_criticalExit(MJL_SPI_S *const state, uint32_t intState){
+  if(NULL != state->opt_hal_criticalExit){
+    state->opt_hal_criticalExit(intState);
+  }
+}
+
+/*******************************************************************************
+* Function Name: spi_isQueueIdle()
+********************************************************************************
+* \brief
+*   Check if all queued transactions have completed
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \return
+*  True if the queue is empty
+*******************************************************************************/
+bool spi_isQueueIdle(MJL_SPI_S *const state){
+  return (NULL == state->_queueHead[MJL_SPI_PRIORITY_HIGH]) && (NULL == state->_queueHead[MJL_SPI_PRIORITY_LOW]);
+}
+
+/*******************************************************************************
+* Function Name: spi_isTransferBusy()
+********************************************************************************
+* \brief
+*   Check if a transaction is still owned by the queue, for callers that poll
+*   instead of using fn_complete
+*
+* \param xfer [in]
+* Transaction to check
+*
+* \return
+*  True if the transaction has not completed
+*******************************************************************************/
+bool spi_isTransferBusy(MJL_SPI_XFER_S *const xfer){
+  return xfer->_busy;
+}
+
+/*******************************************************************************
+* Function Name: spi_getMaxWait()
+********************************************************************************
+* \brief
+*   Longest time a transaction of the given priority waited between 
+*   spi_queueTransfer() and its first byte, in opt_hal_getTicks ticks. This is
+*   the measured worst case latency of the queue.
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param priority [in]
+* Queue to report
+*
+* \param ticks [out]
+* Longest wait
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_getMaxWait(MJL_SPI_S *const state, MJL_SPI_PRIORITY_T priority, uint32_t *ticks){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(NULL == state->opt_hal_getTicks){error|=ERROR_UNAVAILABLE;}
+  if(priority >= MJL_SPI_PRIORITY_NUM){error|=ERROR_VAL;}
+  if(!error){
+    *ticks = state->maxWaitTicks[priority];
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_resetMaxWait()
+********************************************************************************
+* \brief
+*   Restart the latency measurement of every priority
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t spi_resetMaxWait(MJL_SPI_S *const state){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!error){
+    for(uint8_t i = 0; i < MJL_SPI_PRIORITY_NUM; i++){
+      state->maxWaitTicks[i] = 0;
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_fillTx()
+********************************************************************************
+* \brief
+*   Write as many bytes of the current chunk as fit within fifoDepth bytes in
+*   flight
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param xfer [in/out]
+* Transaction being serviced
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t spi_fillTx(MJL_SPI_S *const state, MJL_SPI_XFER_S *const xfer){
+  uint32_t error = 0;
+  uint16_t num = xfer->_chunkEnd - xfer->_txIdx;
+  uint16_t space = state->fifoDepth - (xfer->_txIdx - xfer->_rxIdx);
+  if(num > space){num = space;}
+  if(num > 0){
+    error |= spi_writeChunk(state, (NULL == xfer->tx) ? NULL : &xfer->tx[xfer->_txIdx], num);
+    xfer->_txIdx += num;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_writeChunk()
+********************************************************************************
+* \brief
+*   Place num bytes in the TX FIFO, dummy bytes when tx is NULL. The caller 
+*   guarantees they fit.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param tx [in]
+* Data to send or NULL
+*
+* \param num [in]
+* Number of bytes
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t spi_writeChunk(MJL_SPI_S *const state, const uint8_t *tx, uint16_t num){
+  uint32_t error = 0;
+  if(NULL != tx){
+    error |= state->req_hal_writeArray_blocking(tx, num);
+  } else {
+    while(num > 0){
+      uint16_t chunk = (num < sizeof(spi_dummy)) ? num : sizeof(spi_dummy);
+      error |= state->req_hal_writeArray_blocking(spi_dummy, chunk);
+      num -= chunk;
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_readChunk()
+********************************************************************************
+* \brief
+*   Move num bytes out of the RX FIFO, discarding them when rx is NULL. Uses
+*   the bulk hook when present so a chunk costs one indirect call.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param rx [out]
+* Destination or NULL
+*
+* \param num [in]
+* Number of bytes, no more than are in the RX FIFO
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t spi_readChunk(MJL_SPI_S *const state, uint8_t *rx, uint16_t num){
+  uint32_t error = 0;
+  uint8_t discard[MJL_SPI_FIFO_DEPTH_DEFAULT];
+  while(num > 0){
+    uint16_t chunk = num;
+    uint8_t *dst = rx;
+    if(NULL == rx){
+      dst = discard;
+      if(chunk > sizeof(discard)){chunk = sizeof(discard);}
+    }
+    if(NULL != state->opt_hal_readArray){
+      error |= state->opt_hal_readArray(dst, chunk);
+    } else {
+      for(uint16_t i = 0; i < chunk; i++){
+        error |= state->req_hal_read(&dst[i]);
+      }
+    }
+    if(NULL != rx){rx += chunk;}
+    num -= chunk;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: spi_abortQueue()
+********************************************************************************
+* \brief
+*   Remove every queued transaction, completing each with ERROR_STOPPED
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t spi_abortQueue(MJL_SPI_S *const state){
+  uint32_t error = 0;
+  error |= spi_setIrq(state, false);
+  if(state->_dma._busy){
+    if(NULL != state->opt_hal_dmaAbort){
+      state->opt_hal_dmaAbort();
+    }
+    state->_dma._busy = false;
+  }
+  if(NULL != state->_active){
+    error |= state->req_hal_clearTxBuffer();
+    error |= state->req_hal_clearRxBuffer();
+    spi_deselect(state);
+    state->_active = NULL;
+  }
+  for(uint8_t prio = 0; prio < MJL_SPI_PRIORITY_NUM; prio++){
+    MJL_SPI_XFER_S *xfer = state->_queueHead[prio];
+    state->_queueHead[prio] = NULL;
+    state->_queueTail[prio] = NULL;
+    while(NULL != xfer){
+      MJL_SPI_XFER_S *next = xfer->_next;
+      xfer->_busy = false;
+      if(NULL != xfer->fn_complete){
+        xfer->fn_complete(xfer, xfer->_error | ERROR_STOPPED);
+      }
+      xfer = next;
+    }
+  }
+  return error;
+}
+
 /* [] END OF FILE */
\ No newline at end of file
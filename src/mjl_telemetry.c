@@ -0,0 +1,266 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: mjl_telemetry.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+*
+* Brief: Binary telemetry over a uart, see mjl_telemetry.h
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "mjl_telemetry.h"
+#include <stddef.h>
+#include <string.h>
+
+#define TELEM_COBS_BLOCK    (0xFF)  /* Code of a block of 254 non-zero bytes */
+
+/* Value bytes of each MJL_TELEM_KIND_T */
+static const uint8_t telem_kindLen[MJL_TELEM_KIND_NUM] = {2, 4, 4, 4};
+
+static uint32_t mjl_telem_add(MJL_TELEM_S *const state, uint8_t channel, MJL_TELEM_KIND_T kind, uint32_t value);
+
+const MJL_TELEM_CFG_S mjl_telem_cfg_default = {
+  .uart = NULL,
+  .buffer = NULL,
+  .bufferLen = 0,
+  .opt_samplesPerFrame = 0,
+  .opt_getTicks = NULL,
+};
+
+/*******************************************************************************
+* Function Name: mjl_telem_init()
+********************************************************************************
+* \brief
+*   Initializes the telemetry state struct from a configuration struct
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param cfg [in]
+* Pointer to the configuration struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_telem_init(MJL_TELEM_S *const state, MJL_TELEM_CFG_S *const cfg){
+  uint32_t error = 0;
+  /* Verify required params */
+  error |= (NULL == cfg->uart) ? ERROR_POINTER : ERROR_NONE;
+  error |= (NULL == cfg->buffer) ? ERROR_POINTER : ERROR_NONE;
+  /* Samples per frame and ticks are not required */
+  /* Room for the COBS overhead in front of the raw frame, see mjl_telem_cobsEncode() */
+  uint16_t rawStart = 1 + (cfg->bufferLen / 255);
+  if(cfg->bufferLen < MJL_TELEM_BUFFER_LEN(1)){error|=ERROR_PARAM;}
+  if(!error){
+    state->uart = cfg->uart;
+    state->buffer = cfg->buffer;
+    state->bufferLen = cfg->bufferLen;
+    state->samplesPerFrame = cfg->opt_samplesPerFrame;
+    state->opt_getTicks = cfg->opt_getTicks;
+    state->_rawStart = rawStart;
+    state->_rawMax = cfg->bufferLen - rawStart - 1;
+    state->_rawLen = 0;
+    state->_count = 0;
+    state->seq = 0;
+    state->framesSent = 0;
+    state->framesDropped = 0;
+    state->_init = true;
+  }
+  if(error){state->_init=false;}
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_telem_addI16()
+********************************************************************************
+* \brief
+*   Add a sample to the frame being built, sending it when full
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param channel [in]
+* Application defined channel of the sample
+*
+* \param value [in]
+* Sample value
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_telem_addI16(MJL_TELEM_S *const state, uint8_t channel, int16_t value){
+  return mjl_telem_add(state, channel, MJL_TELEM_KIND_I16, (uint16_t) value);
+}
+
+/* See mjl_telem_addI16() */
+uint32_t mjl_telem_addI32(MJL_TELEM_S *const state, uint8_t channel, int32_t value){
+  return mjl_telem_add(state, channel, MJL_TELEM_KIND_I32, (uint32_t) value);
+}
+
+/* See mjl_telem_addI16() */
+uint32_t mjl_telem_addU32(MJL_TELEM_S *const state, uint8_t channel, uint32_t value){
+  return mjl_telem_add(state, channel, MJL_TELEM_KIND_U32, value);
+}
+
+/* See mjl_telem_addI16(), the value is sent as its IEEE-754 bits */
+uint32_t mjl_telem_addFloat(MJL_TELEM_S *const state, uint8_t channel, float value){
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  return mjl_telem_add(state, channel, MJL_TELEM_KIND_FLOAT, bits);
+}
+
+/*******************************************************************************
+* Function Name: mjl_telem_flush()
+********************************************************************************
+* \brief
+*   Send the frame being built, if it holds any samples. The sequence number
+*   advances even if the uart rejects the frame, so the host sees the loss.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t mjl_telem_flush(MJL_TELEM_S *const state){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!error && state->_count){
+    uint8_t *raw = &state->buffer[state->_rawStart];
+    raw[MJL_TELEM_HEADER_LEN - 1] = state->_count;
+    uint16_t crc = mjl_telem_crc16(MJL_TELEM_CRC_INIT, raw, state->_rawLen);
+    raw[state->_rawLen++] = (uint8_t) crc;
+    raw[state->_rawLen++] = (uint8_t) (crc >> 8);
+    uint16_t len = mjl_telem_cobsEncode(state->buffer, state->_rawStart, state->_rawLen);
+    error |= uart_writeArray(state->uart, state->buffer, len);
+    if(error){state->framesDropped++;}
+    else {state->framesSent++;}
+    state->seq++;
+    state->_rawLen = 0;
+    state->_count = 0;
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: mjl_telem_crc16()
+********************************************************************************
+* \brief
+*   Update a CRC-16/CCITT-FALSE with len bytes, start from MJL_TELEM_CRC_INIT.
+*   Polynomial 0x1021 a byte at a time with shifts, no table
+*
+* \param crc [in]
+* CRC of the previous bytes
+*
+* \param data [in]
+* Bytes to add
+*
+* \param len [in]
+* Number of bytes
+*
+* \return
+*  Updated CRC
+*******************************************************************************/
+uint16_t mjl_telem_crc16(uint16_t crc, const uint8_t *data, uint16_t len){
+  for(uint16_t i = 0; i < len; i++){
+    uint16_t x = (uint8_t) ((crc >> 8) ^ data[i]);
+    x ^= x >> 4;
+    crc = (uint16_t) ((crc << 8) ^ (x << 12) ^ (x << 5) ^ x);
+  }
+  return crc;
+}
+
+/*******************************************************************************
+* Function Name: mjl_telem_cobsEncode()
+********************************************************************************
+* \brief
+*   COBS encode len bytes held at buffer[start] into the front of the same
+*   buffer and append the 0x00 delimiter. The output never passes the input
+*   when start is at least 1 + len / 254.
+*
+* \param buffer [in/out]
+* Raw bytes at start, encoded bytes from 0
+*
+* \param start [in]
+* Index of the first raw byte
+*
+* \param len [in]
+* Number of raw bytes
+*
+* \return
+*  Encoded bytes, delimiter included
+*******************************************************************************/
+uint16_t mjl_telem_cobsEncode(uint8_t *buffer, uint16_t start, uint16_t len){
+  uint16_t read = start;
+  uint16_t end = start + len;
+  uint16_t write = 1;
+  uint16_t codeIdx = 0;
+  uint8_t code = 1;
+  while(read < end){
+    uint8_t data = buffer[read++];
+    if(0 == data){
+      buffer[codeIdx] = code;
+      codeIdx = write++;
+      code = 1;
+    }
+    else {
+      buffer[write++] = data;
+      if(TELEM_COBS_BLOCK == ++code){
+        buffer[codeIdx] = code;
+        codeIdx = write++;
+        code = 1;
+      }
+    }
+  }
+  buffer[codeIdx] = code;
+  buffer[write++] = 0;
+  return write;
+}
+
+/*******************************************************************************
+* Function Name: mjl_telem_add()
+********************************************************************************
+* \brief
+*   Append one record, sending the frame first when it would not fit and
+*   after it when opt_samplesPerFrame is reached
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t mjl_telem_add(MJL_TELEM_S *const state, uint8_t channel, MJL_TELEM_KIND_T kind, uint32_t value){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!error){
+    uint8_t valueLen = telem_kindLen[kind];
+    uint16_t recordLen = 2 + valueLen;
+    if((state->_rawLen + recordLen + MJL_TELEM_CRC_LEN > state->_rawMax) || (UINT8_MAX == state->_count)){
+      error |= mjl_telem_flush(state);
+    }
+    uint8_t *raw = &state->buffer[state->_rawStart];
+    /* Header of a new frame, the count is filled in when it is sent */
+    if(0 == state->_count){
+      uint32_t ticks = (NULL != state->opt_getTicks) ? state->opt_getTicks() : 0;
+      raw[0] = MJL_TELEM_VERSION;
+      raw[1] = (uint8_t) state->seq;
+      raw[2] = (uint8_t) (state->seq >> 8);
+      raw[3] = (uint8_t) ticks;
+      raw[4] = (uint8_t) (ticks >> 8);
+      raw[5] = (uint8_t) (ticks >> 16);
+      raw[6] = (uint8_t) (ticks >> 24);
+      state->_rawLen = MJL_TELEM_HEADER_LEN;
+    }
+    raw[state->_rawLen++] = channel;
+    raw[state->_rawLen++] = (uint8_t) kind;
+    for(uint8_t i = 0; i < valueLen; i++){
+      raw[state->_rawLen++] = (uint8_t) (value >> (8 * i));
+    }
+    state->_count++;
+    if(state->samplesPerFrame && (state->_count >= state->samplesPerFrame)){
+      error |= mjl_telem_flush(state);
+    }
+  }
+  return error;
+}
+
+/* [] END OF FILE */
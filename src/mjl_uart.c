@@ -12,13 +12,48 @@
 ********************************************************************************/
 #include "mjl_uart.h"
 #include "mjl_errors.h" 
+#include "mjl_metrics.h"
+#include "mjl_format.h"
+#include "mjl_parse.h"
 #include <stdarg.h>
 #include <stddef.h>
-#include "float.h"
+#include <string.h>
 
-static const double pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
 const uint8_t hexAscii[HEX_VAL_MAX+1] = "0123456789ABCDEF";
 
+static uint32_t uart_txEnqueue(MLJ_UART_S *const state, const uint8_t *array, uint16_t len);
+static uint32_t uart_txService(MLJ_UART_S *const state);
+static void uart_txDmaComplete(MJL_DMA_DESC_S *const desc, uint32_t error);
+static uint32_t uart_criticalEnter(MLJ_UART_S *const state);
+static void uart_criticalExit(MLJ_UART_S *const state, uint32_t intState);
+
+/* Every write reaches the HAL or the TX ring through here, so it is counted */
+static inline uint32_t uart_halWrite(MLJ_UART_S *const state, const uint8_t *array, uint16_t len){
+  MJL_METRIC_INC(MJL_METRIC_UART_WRITES);
+  MJL_METRIC_ADD(MJL_METRIC_UART_BYTES, len);
+  if(state->_isAsync){
+    return uart_txEnqueue(state, array, len);
+  }
+  return state->hal_req_writeArray(array, len);
+}
+
+/* Output of uart_vformat() waiting to be written */
+typedef struct {
+  MJL_UART_FMT_WRITE_T write;
+  void *ctx;
+  uint8_t buf[UART_PRINTF_BUFFER_LEN];
+  uint16_t len;
+  uint32_t error;
+} uart_fmt_s;
+
+#ifndef MJL_UART_PRINT_DISABLE
+static uint32_t uart_fmtWriteUart(void *ctx, const uint8_t *array, uint16_t len);
+#endif
+static void uart_fmtFlush(uart_fmt_s *const fmt);
+static void uart_fmtPut(uart_fmt_s *const fmt, uint8_t data);
+static void uart_fmtPutString(uart_fmt_s *const fmt, const char *str);
+static void uart_fmtPutArray(uart_fmt_s *const fmt, const uint8_t *array, uint8_t len);
+
 
 /* Default config struct */
 const MJL_UART_CFG_S uart_cfg_default = {
@@ -26,7 +61,19 @@ const MJL_UART_CFG_S uart_cfg_default = {
   .hal_req_read = NULL,
   .hal_opt_externalStart = NULL,
   .hal_opt_externalStop = NULL,
+  .hal_opt_dmaStart = NULL,
+  .hal_opt_getTxFree = NULL,
+  .hal_opt_setTxIrq = NULL,
+  .hal_opt_setRxIrq = NULL,
+  .hal_opt_criticalEnter = NULL,
+  .hal_opt_criticalExit = NULL,
   .opt_baud = 0,
+  .opt_txBuffer = NULL,
+  .opt_txBufferLen = 0,
+  .opt_txPolicy = MJL_UART_TX_POLICY_BLOCK,
+  .opt_rxBuffer = NULL,
+  .opt_rxBufferLen = 0,
+  .opt_fn_rxReceived = NULL,
 };
 
 /*******************************************************************************
@@ -52,6 +99,28 @@ uint32_t uart_init(MLJ_UART_S *const state, MJL_UART_CFG_S *const cfg){
   /* external start is not required */
   /* external stop is not required */
   /* baud is not required */
+  /* A TX ring is drained by the DMA, or by the TX interrupt, inside critical sections */
+  bool isAsync = (NULL != cfg->opt_txBuffer);
+  if(isAsync){
+    bool isDrained = (NULL != cfg->hal_opt_dmaStart) || ((NULL != cfg->hal_opt_getTxFree) && (NULL != cfg->hal_opt_setTxIrq));
+    error |= isDrained ? ERROR_NONE : ERROR_POINTER;
+    error |= ((NULL == cfg->hal_opt_criticalEnter) || (NULL == cfg->hal_opt_criticalExit)) ? ERROR_POINTER : ERROR_NONE;
+    error |= (cfg->opt_txPolicy > MJL_UART_TX_POLICY_OVERWRITE) ? ERROR_PARAM : ERROR_NONE;
+  }
+  /* An RX ring is filled by the RX interrupt and emptied inside critical sections */
+  bool isRxAsync = (NULL != cfg->opt_rxBuffer);
+  if(isRxAsync){
+    error |= (NULL == cfg->hal_opt_setRxIrq) ? ERROR_POINTER : ERROR_NONE;
+    error |= ((NULL == cfg->hal_opt_criticalEnter) || (NULL == cfg->hal_opt_criticalExit)) ? ERROR_POINTER : ERROR_NONE;
+  }
+  if(!error && isAsync){
+    mjl_ring_u8_cfg_s ringCfg = {.buffer = cfg->opt_txBuffer, .size = cfg->opt_txBufferLen, .overWrite = false};
+    error |= mjl_ring_u8_init(&state->_txRing, &ringCfg);
+  }
+  if(!error && isRxAsync){
+    mjl_ring_u8_cfg_s ringCfg = {.buffer = cfg->opt_rxBuffer, .size = cfg->opt_rxBufferLen, .overWrite = false};
+    error |= mjl_ring_u8_init(&state->_rxRing, &ringCfg);
+  }
   /* Valid Inputs */
   if(!error) {
     /* Copy params */
@@ -59,7 +128,23 @@ uint32_t uart_init(MLJ_UART_S *const state, MJL_UART_CFG_S *const cfg){
     state->hal_req_read = cfg->hal_req_read;
     state->hal_opt_externalStart =  cfg->hal_opt_externalStart;
     state->hal_opt_externalStop = cfg->hal_opt_externalStop;
+    state->hal_opt_dmaStart = cfg->hal_opt_dmaStart;
+    state->hal_opt_getTxFree = cfg->hal_opt_getTxFree;
+    state->hal_opt_setTxIrq = cfg->hal_opt_setTxIrq;
+    state->hal_opt_setRxIrq = cfg->hal_opt_setRxIrq;
+    state->hal_opt_criticalEnter = cfg->hal_opt_criticalEnter;
+    state->hal_opt_criticalExit = cfg->hal_opt_criticalExit;
     state->baud = cfg->opt_baud;
+    state->_dmaDesc = NULL;
+    state->txPolicy = cfg->opt_txPolicy;
+    memset(&state->txStats, 0, sizeof(state->txStats));
+    memset(&state->_txDma, 0, sizeof(state->_txDma));
+    state->_txInFlight = 0;
+    state->_isAsync = isAsync;
+    state->_txIrqEnabled = false;
+    state->opt_fn_rxReceived = cfg->opt_fn_rxReceived;
+    state->rxOverflow = 0;
+    state->_isRxAsync = isRxAsync;
     /* Mark as initialized */
     state->_init = true;
     state->_running = false;
@@ -93,6 +178,14 @@ uint32_t uart_start(MLJ_UART_S *const state){
     if(NULL != state->hal_opt_externalStart){
       error |= state->hal_opt_externalStart((MLJ_UART_T *const) state);
     }
+    /* Resume sending what was queued while stopped */
+    if(!error && state->_isAsync){
+      error |= uart_txService(state);
+    }
+    /* Received bytes are queued by uart_rxIsr() from here on */
+    if(!error && state->_isRxAsync){
+      error |= state->hal_opt_setRxIrq(true);
+    }
   }
   return error;
 }
@@ -115,6 +208,15 @@ uint32_t uart_stop(MLJ_UART_S *const state){
   if(!state->_running){error|=ERROR_STOPPED;}
 
   if(!error){
+    /* Queued bytes stay in the TX ring until the next start */
+    if(state->_txIrqEnabled){
+      error |= state->hal_opt_setTxIrq(false);
+      state->_txIrqEnabled = false;
+    }
+    /* Bytes already in the RX ring can still be read */
+    if(state->_isRxAsync){
+      error |= state->hal_opt_setRxIrq(false);
+    }
     /* Run the external stop function if present  */
     if(NULL != state->hal_opt_externalStop){
       error |= state->hal_opt_externalStop((MLJ_UART_T *const) state);
@@ -187,16 +289,379 @@ uint32_t uart_writeArray(MLJ_UART_S *const state, uint8_t * array, uint16_t len)
   if(!state->isLoggingEnabled){error|=ERROR_MODE;}
 
   if(!error){
-    error|= state->hal_req_writeArray(array, len);
+    error|= uart_halWrite(state, array, len);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_writeArray_dma()
+********************************************************************************
+* \brief
+*   Writes desc->len bytes of desc->tx out the uart by DMA without waiting.
+*   desc->fn_complete is called from the DMA interrupt once the last byte is
+*   in the TX FIFO. The descriptor and its data must stay valid until then, 
+*   and other writes must wait for it, see uart_isDmaBusy().
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param desc [in/out]
+* Descriptor of the data to write, desc->rx is ignored
+* 
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_writeArray_dma(MLJ_UART_S *const state, MJL_DMA_DESC_S *const desc){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!state->_running){error|=ERROR_STOPPED;}
+  if(!state->isLoggingEnabled){error|=ERROR_MODE;}
+  if(NULL == state->hal_opt_dmaStart){error|=ERROR_UNAVAILABLE;}
+  /* The TX ring owns the channel */
+  if(state->_isAsync){error|=ERROR_MODE;}
+  if((NULL == desc) || (NULL == desc->tx)){error|=ERROR_POINTER;}
+  else if(0 == desc->len){error|=ERROR_VAL;}
+  else if(desc->_busy || uart_isDmaBusy(state)){error|=ERROR_RUNNING;}
+
+  if(!error){
+    desc->_busy = true;
+    state->_dmaDesc = desc;
+    error |= state->hal_opt_dmaStart(desc);
+    if(error){desc->_busy = false;}
+    else {MJL_METRIC_ADD(MJL_METRIC_UART_BYTES, desc->len);}
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_isDmaBusy()
+********************************************************************************
+* \brief
+*   Check if a write started with uart_writeArray_dma() is still running
+*
+* \param state [in]
+* Pointer to the state struct
+* 
+* \return
+*  True while the DMA owns the TX FIFO
+*******************************************************************************/
+bool uart_isDmaBusy(MLJ_UART_S *const state){
+  return (NULL != state->_dmaDesc) && mjl_dma_isBusy(state->_dmaDesc);
+}
+
+/*******************************************************************************
+* Function Name: uart_txIsr()
+********************************************************************************
+* \brief
+*   Drain the TX ring into the TX FIFO. Called by the HAL interrupt handler of 
+*   the TX FIFO not full interrupt enabled with hal_opt_setTxIrq(). The DMA 
+*   drain needs no call, it continues from the DMA completion.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*******************************************************************************/
+void uart_txIsr(MLJ_UART_S *const state){
+  if(state->_isAsync){
+    (void) uart_txService(state);
+  }
+}
+
+/*******************************************************************************
+* Function Name: uart_rxIsr()
+********************************************************************************
+* \brief
+*   Move every byte of the RX FIFO into the RX ring. Called by the HAL 
+*   interrupt handler of the RX FIFO not empty interrupt enabled with 
+*   hal_opt_setRxIrq(). Bytes that do not fit are dropped and counted in 
+*   rxOverflow, so the FIFO is always emptied and the interrupt clears.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*******************************************************************************/
+void uart_rxIsr(MLJ_UART_S *const state){
+  if(state->_isRxAsync){
+    uint8_t data;
+    bool isQueued = false;
+    while(ERROR_NONE == state->hal_req_read(&data)){
+      if(mjl_ring_u8_enqueue(&state->_rxRing, data)){state->rxOverflow++;}
+      else {isQueued = true;}
+    }
+    if(isQueued && (NULL != state->opt_fn_rxReceived)){
+      state->opt_fn_rxReceived((MLJ_UART_T *const) state);
+    }
+  }
+}
+
+/*******************************************************************************
+* Function Name: uart_flush()
+********************************************************************************
+* \brief
+*   Wait until every byte of the TX ring has been handed to the hardware, e.g.
+*   before sleeping or resetting. Returns at once without a TX ring. Gives up
+*   when no byte leaves the ring for UART_TX_STALL_MAX passes, e.g. a stuck
+*   FIFO or a DMA that never completes, about a second at 48 MHz. Raise it for
+*   long DMA spans at low baud rates.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation, ERROR_TIMEOUT if the ring stopped draining
+*******************************************************************************/
+uint32_t uart_flush(MLJ_UART_S *const state){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!state->_running){error|=ERROR_STOPPED;}
+
+  if(!error && state->_isAsync){
+    uint32_t pending = UINT32_MAX;
+    uint32_t stalls = 0;
+    while(!error && (!mjl_ring_u8_isBufferEmpty(&state->_txRing) || (0 != state->_txInFlight))){
+      /* Bytes still queued or out with the DMA only go down while draining */
+      uint32_t num = (uint32_t) state->_txRing.count + state->_txInFlight;
+      if(num < pending){
+        pending = num;
+        stalls = 0;
+      }
+      else if(++stalls >= UART_TX_STALL_MAX){
+        error|=ERROR_TIMEOUT;
+        break;
+      }
+      error |= uart_txService(state);
+    }
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_getTxStats()
+********************************************************************************
+* \brief
+*   Copy out the TX ring statistics
+*
+* \param state [in]
+* Pointer to the state struct
+*
+* \param stats [out]
+* Destination of the statistics
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_getTxStats(MLJ_UART_S *const state, MJL_UART_TX_STATS_S *const stats){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(NULL == stats){error|=ERROR_POINTER;}
+  if(!error){
+    uint32_t intState = uart_criticalEnter(state);
+    *stats = state->txStats;
+    uart_criticalExit(state, intState);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_resetTxStats()
+********************************************************************************
+* \brief
+*   Clear the TX ring statistics, the high water mark restarts from the bytes 
+*   queued now
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_resetTxStats(MLJ_UART_S *const state){
+  uint32_t error = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+  if(!error){
+    uint32_t intState = uart_criticalEnter(state);
+    memset(&state->txStats, 0, sizeof(state->txStats));
+    state->txStats.highWater = state->_isAsync ? state->_txRing.count : 0;
+    uart_criticalExit(state, intState);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_txEnqueue()
+********************************************************************************
+* \brief
+*   Copy a write into the TX ring and start draining it. A write that does not
+*   fit follows the TX policy. A blocked write gives up like uart_flush().
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param array [in]
+* Data to send
+*
+* \param len [in]
+* Number of bytes
+*
+* \return
+*  Error code of the operation, ERROR_UNAVAILABLE if the write was dropped,
+*  ERROR_TIMEOUT if a blocked write found no space for UART_TX_STALL_MAX passes
+*******************************************************************************/
+static uint32_t uart_txEnqueue(MLJ_UART_S *const state, const uint8_t *array, uint16_t len){
+  uint32_t error = 0;
+  mjl_ring_u8_s *ring = &state->_txRing;
+  bool isBlocked = false;
+  uint32_t stalls = 0;
+  while(!error && (len > 0)){
+    uint32_t intState = uart_criticalEnter(state);
+    /* Bytes out with the DMA are outside the ring but their space is not free yet */
+    uint16_t capacity = ring->size - state->_txInFlight;
+    uint16_t space = capacity - ring->count;
+    uint16_t num = len;
+    if(num > space){
+      if(MJL_UART_TX_POLICY_DROP == state->txPolicy){
+        state->txStats.bytesDropped += len;
+        error|=ERROR_UNAVAILABLE;
+        num = 0;
+        len = 0;
+      } 
+      else if(MJL_UART_TX_POLICY_OVERWRITE == state->txPolicy){
+        /* Only the newest bytes of a write longer than the ring survive */
+        if(num > capacity){
+          state->txStats.bytesDropped += num - capacity;
+          array += num - capacity;
+          num = capacity;
+          len = capacity;
+        }
+        if(num > space){
+          uint16_t discard = num - space;
+          (void) mjl_ring_u8_commitRead(ring, discard);
+          state->txStats.bytesOverwritten += discard;
+        }
+      } 
+      else {
+        num = space;
+        if(!isBlocked){
+          isBlocked = true;
+          state->txStats.blockedWrites++;
+        }
+        if(num > 0){stalls = 0;}
+        else if(++stalls >= UART_TX_STALL_MAX){error|=ERROR_TIMEOUT;}
+      }
+    }
+    if(num > 0){
+      mjl_ring_u8_span_s first, second;
+      (void) mjl_ring_u8_peekWrite(ring, &first, &second);
+      uint16_t numFirst = (num < first.len) ? num : first.len;
+      memcpy(first.data, array, numFirst);
+      memcpy(second.data, &array[numFirst], num - numFirst);
+      (void) mjl_ring_u8_commitWrite(ring, num);
+      state->txStats.bytesQueued += num;
+      if(ring->count > state->txStats.highWater){state->txStats.highWater = ring->count;}
+      array += num;
+      len -= num;
+    }
+    uart_criticalExit(state, intState);
+    /* Start the drain, while blocked this also frees space without the interrupt */
+    error |= uart_txService(state);
+  }
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_txService()
+********************************************************************************
+* \brief
+*   Move bytes from the TX ring to the hardware without waiting. With the DMA 
+*   hook the next contiguous span is handed to the DMA if it is idle, otherwise
+*   what fits is written to the TX FIFO and the TX interrupt stays enabled 
+*   while bytes remain.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \return
+*  Error code of the operation
+*******************************************************************************/
+static uint32_t uart_txService(MLJ_UART_S *const state){
+  uint32_t error = 0;
+  mjl_ring_u8_s *ring = &state->_txRing;
+  mjl_ring_u8_span_s first, second;
+  uint32_t intState = uart_criticalEnter(state);
+  if(NULL != state->hal_opt_dmaStart){
+    if(!mjl_dma_isBusy(&state->_txDma) && !mjl_ring_u8_isBufferEmpty(ring)){
+      (void) mjl_ring_u8_peekRead(ring, &first, &second);
+      MJL_DMA_DESC_S *desc = &state->_txDma;
+      desc->tx = first.data;
+      desc->rx = NULL;
+      desc->len = first.len;
+      desc->fn_complete = uart_txDmaComplete;
+      desc->context = state;
+      desc->_busy = true;
+      state->_dmaDesc = desc;
+      error |= state->hal_opt_dmaStart(desc);
+      if(error){desc->_busy = false;}
+      else {
+        /* The completion cannot run before the critical section ends */
+        state->_txInFlight = first.len;
+        (void) mjl_ring_u8_commitRead(ring, first.len);
+      }
+    }
+  } else {
+    uint32_t free = state->hal_opt_getTxFree();
+    while((free > 0) && !mjl_ring_u8_isBufferEmpty(ring) && !error){
+      (void) mjl_ring_u8_peekRead(ring, &first, &second);
+      uint16_t num = (first.len < free) ? first.len : (uint16_t) free;
+      error |= state->hal_req_writeArray(first.data, num);
+      (void) mjl_ring_u8_commitRead(ring, num);
+      free -= num;
+    }
+    bool isPending = !mjl_ring_u8_isBufferEmpty(ring);
+    if(isPending != state->_txIrqEnabled){
+      error |= state->hal_opt_setTxIrq(isPending);
+      state->_txIrqEnabled = isPending;
+    }
   }
+  uart_criticalExit(state, intState);
   return error;
 }
 
+/*******************************************************************************
+* Function Name: uart_txDmaComplete()
+********************************************************************************
+* \brief
+*   DMA completion callback, runs in the DMA interrupt. Releases the space of
+*   the span just sent and starts the next one.
+*
+* \param desc [in/out]
+* Descriptor of the finished transfer
+*
+* \param error [in]
+* Error code reported by the HAL
+*******************************************************************************/
+static void uart_txDmaComplete(MJL_DMA_DESC_S *const desc, uint32_t error){
+  MLJ_UART_S *const state = (MLJ_UART_S *) desc->context;
+  (void) error;
+  state->_txInFlight = 0;
+  (void) uart_txService(state);
+}
+
+/* Critical section around the TX ring bookkeeping, empty without the hooks */
+static uint32_t uart_criticalEnter(MLJ_UART_S *const state){
+  return (NULL == state->hal_opt_criticalEnter) ? 0 : state->hal_opt_criticalEnter();
+}
+
+static void uart_criticalExit(MLJ_UART_S *const state, uint32_t intState){
+  if(NULL != state->hal_opt_criticalExit){
+    state->hal_opt_criticalExit(intState);
+  }
+}
+
 /*******************************************************************************
 * Function Name: uart_readArray()
 ********************************************************************************
 * \brief
-*   Reads in data from the UART 
+*   Reads in data from the UART. With an RX ring nothing is read unless len 
+*   bytes have been received, ERROR_UNAVAILABLE is returned instead.
 *
 * \param state [in/out]
 * Pointer to the state struct
@@ -215,7 +680,15 @@ uint32_t uart_readArray(MLJ_UART_S *const state, uint8_t * array, uint16_t len){
   if(!state->_init){error|=ERROR_INIT;}
   if(!state->_running){error|=ERROR_STOPPED;}
 
-  if(!error){
+  if(!error && state->_isRxAsync){
+    uint32_t intState = state->hal_opt_criticalEnter();
+    if(state->_rxRing.count < len){error|=ERROR_UNAVAILABLE;}
+    for(uint16_t i=0; (i<len) && !error; i++){
+      error |= mjl_ring_u8_dequeue(&state->_rxRing, &array[i]);
+    }
+    state->hal_opt_criticalExit(intState);
+  }
+  else if(!error){
     for(uint16_t i=0; i<len; i++){
       error |= state->hal_req_read(&array[i]);
       if(error){break;}
@@ -224,6 +697,56 @@ uint32_t uart_readArray(MLJ_UART_S *const state, uint8_t * array, uint16_t len){
   return error;
 };
 
+/*******************************************************************************
+* Function Name: uart_readAvailable()
+********************************************************************************
+* \brief
+*   Reads in the data received so far, up to len bytes, without waiting. 
+*   Nothing received is not an error, num is 0.
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param array [out]
+* Pointer to the data
+*
+* \param len [in]
+* Most characters to read
+*
+* \param num [out]
+* Number of characters read
+* 
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_readAvailable(MLJ_UART_S *const state, uint8_t * array, uint16_t len, uint16_t *num){
+  uint32_t error = 0;
+  *num = 0;
+  if(!state->_init){error|=ERROR_INIT;}
+
+  if(!error && state->_isRxAsync){
+    /* Copy out of the ring in at most two pieces */
+    uint32_t intState = state->hal_opt_criticalEnter();
+    mjl_ring_u8_span_s first, second;
+    error |= mjl_ring_u8_peekRead(&state->_rxRing, &first, &second);
+    if(!error){
+      uint16_t firstLen = (first.len < len) ? first.len : len;
+      uint16_t secondLen = ((len - firstLen) < second.len) ? (len - firstLen) : second.len;
+      memcpy(array, first.data, firstLen);
+      memcpy(&array[firstLen], second.data, secondLen);
+      error |= mjl_ring_u8_commitRead(&state->_rxRing, firstLen + secondLen);
+      *num = firstLen + secondLen;
+    }
+    state->hal_opt_criticalExit(intState);
+  }
+  else if(!error && state->_running){
+    while((*num < len) && (ERROR_NONE == state->hal_req_read(&array[*num]))){
+      (*num)++;
+    }
+  }
+  return error;
+}
+
 
 /*******************************************************************************
 * Function Name: uart_write_reverse()
@@ -250,14 +773,21 @@ uint32_t uart_write_reverse(MLJ_UART_S *const state, uint8_t * array, uint16_t l
   if(!state->isLoggingEnabled){error|=ERROR_MODE;}
 
   if(!error){
-    for(uint16_t i = len; i >0; i--){
-      error|= state->hal_req_writeArray(&array[i-1], 1);
-      if(error){break;}
+    /* Reverse into a small buffer, one HAL write per chunk */
+    uint8_t chunk[UART_FLOAT_BUFFER_SIZE];
+    while((len > 0) && !error){
+      uint16_t num = (len < sizeof(chunk)) ? len : sizeof(chunk);
+      for(uint16_t i = 0; i < num; i++){
+        chunk[i] = array[len - 1 - i];
+      }
+      error|= uart_halWrite(state, chunk, num);
+      len -= num;
     }
   }
   return error;
 }
 
+#ifndef MJL_UART_PRINT_DISABLE
 /*******************************************************************************
 * Function Name: uart_print()
 ********************************************************************************
@@ -285,7 +815,7 @@ uint32_t uart_print(MLJ_UART_S* state, const char *pszFmt) {
     /* Determine length by finding null */
     while(0 != pszFmt[len]){len++;}
     /* Write the full array, if elements are present */
-    if(0 != len){state->hal_req_writeArray((uint8_t *) pszFmt, len);}
+    if(0 != len){error |= uart_halWrite(state, (uint8_t *) pszFmt, len);}
   }
   return error;
 }
@@ -323,29 +853,99 @@ uint32_t uart_println(MLJ_UART_S *const state, const char * pszFmt){
 * Function Name: uart_printf()
 ********************************************************************************
 * \brief
-*   Prints a character out on the uart 
+*   Prints a formatted string out on the uart, see uart_vprintf()
 *
 * \param state [in/out]
 * Pointer to the state struct
 *
 * \param pszFmt [in]
-* Pointer to a zero-terminated string
+* Pointer to a zero-terminated format string
 * 
 * \return
 *  Error code of the operation
 *******************************************************************************/
 uint32_t uart_printf(MLJ_UART_S* state, const char *pszFmt,...) {
+  va_list args;
+  va_start(args, pszFmt);
+  uint32_t error = uart_vprintf(state, pszFmt, args);
+  va_end(args);
+  return error;
+}
+
+/*******************************************************************************
+* Function Name: uart_vprintf()
+********************************************************************************
+* \brief
+*   Prints a formatted string out on the uart, see uart_vformat()
+*
+* \param state [in/out]
+* Pointer to the state struct
+*
+* \param pszFmt [in]
+* Pointer to a zero-terminated format string
+*
+* \param args [in]
+* Arguments of the format string
+* 
+* \return
+*  Error code of the operation
+*******************************************************************************/
+uint32_t uart_vprintf(MLJ_UART_S* state, const char *pszFmt, va_list args) {
   uint32_t error = 0;
   if(!state->_init){error|=ERROR_INIT;}
   if(!state->_running){error|=ERROR_STOPPED;}
   if(!state->isLoggingEnabled){error|=ERROR_MODE;}
   if(!error){
-    va_list args;
-    va_start(args, pszFmt);
+    error |= uart_vformat(uart_fmtWriteUart, state, pszFmt, args);
+  }
+  return error;
+}
+
+/* Writer of uart_vprintf() */
+static uint32_t uart_fmtWriteUart(void *ctx, const uint8_t *array, uint16_t len){
+  return uart_halWrite((MLJ_UART_S*) ctx, array, len);
+}
+#endif /* MJL_UART_PRINT_DISABLE */
+
+/*******************************************************************************
+* Function Name: uart_vformat()
+********************************************************************************
+* \brief
+*   Formats a string with the specifiers of uart_printf() and hands the output
+*   to a writer, so other sinks share the uart formatting. The output is 
+*   formatted into a UART_PRINTF_BUFFER_LEN stack buffer and written when the 
+*   buffer fills and once at the end, rather than one call per character.
+*
+*   Specifiers: %s string, %b bool, %u %d %i 32 bit integers, %c character,
+*   %x 16 bit and %X 32 bit hex, %f and %.Nf float with N decimals. A
+*   precision above FORMAT_PREC_MAX (9) is clamped to 9 decimals, before
+*   mjl_format the extra decimals were padded with zeros. Magnitudes above
+*   FORMAT_FLOAT_MAX print as "*reqEXP".
+*
+* \param write [in]
+* Writer of the formatted bytes
+*
+* \param ctx [in/out]
+* Passed to the writer
+*
+* \param pszFmt [in]
+* Pointer to a zero-terminated format string
+*
+* \param args [in]
+* Arguments of the format string
+* 
+* \return
+*  Error code of the operation, including the first writer error
+*******************************************************************************/
+uint32_t uart_vformat(MJL_UART_FMT_WRITE_T write, void *ctx, const char *pszFmt, va_list args) {
+  uint32_t error = 0;
+  if((NULL == write) || (NULL == pszFmt)){error|=ERROR_POINTER;}
+  if(!error){
+    uart_fmt_s fmt = {.write = write, .ctx = ctx, .len = 0, .error = 0};
     while(*pszFmt) {
       /* Print until the format specifier is encountered */
       if('%' != *pszFmt) {
-        error |= state->hal_req_writeArray((uint8_t *) pszFmt, 1);
+        uart_fmtPut(&fmt, (uint8_t) *pszFmt);
         pszFmt++;
         continue;
       }
@@ -353,122 +953,53 @@ uint32_t uart_printf(MLJ_UART_S* state, const char *pszFmt,...) {
       pszFmt++;
       /* Format a string */
       if(*pszFmt == 's') {
-        /* Get the pointer to the string */
-        char* str = (char*) va_arg(args, int);
-        for(; *str != '\0'; str++){
-          error |= state->hal_req_writeArray((uint8_t *)str,1);
-        }
+        const char* str = va_arg(args, const char*);
+        uart_fmtPutString(&fmt, str);
         pszFmt++;
         continue;
       }
       /* Boolean */
       else if(*pszFmt == 'b'){
         bool bVal = (bool) va_arg(args, int);
-        if(bVal){
-          error |= uart_print(state, "True");
-        } else {
-          error |= uart_print(state, "False");
-        }
+        uart_fmtPutString(&fmt, bVal ? "True" : "False");
         pszFmt++;
         continue;
       }
       /* Format unsigned integer */
       else if(*pszFmt == 'u'){
-        uint32_t iVal = va_arg(args, uint32_t);
-        uint8_t i = 0;
-        uint8_t buffer[25];
-        do{
-          buffer[i++] = iVal % 10;
-          iVal /= 10;
-        }while(iVal);
-        while(i > 0){
-          i--;
-          uint8_t ascii = 0;
-          error |= uart_hex2Ascii(buffer[i], &ascii);
-          error |= state->hal_req_writeArray(&ascii,1);
-        }
+        uint8_t buffer[FORMAT_U32_LEN];
+        uint8_t len = 0;
+        format_u32(va_arg(args, uint32_t), buffer, &len);
+        uart_fmtPutArray(&fmt, buffer, len);
         pszFmt++;
         continue;
       }
       /* Format signed integer */
       else if(*pszFmt == 'd' || *pszFmt == 'i') {
-        int32_t iVal = va_arg(args, int32_t);
-        uint8_t i = 0;
-        uint8_t buffer[25];
-        /* Check for negative numbers */
-        if (iVal < 0){
-          iVal *= -1;
-          uart_write(state, '-');
-        }
-        do{
-          buffer[i++] = iVal % 10;
-          iVal /= 10;
-        }while(iVal);
-        while(i > 0){
-          i--;
-          uint8_t ascii = 0;
-          error |= uart_hex2Ascii(buffer[i], &ascii);
-          error |= state->hal_req_writeArray(&ascii,1);
-        }
+        uint8_t buffer[FORMAT_I32_LEN];
+        uint8_t len = 0;
+        format_i32(va_arg(args, int32_t), buffer, &len);
+        uart_fmtPutArray(&fmt, buffer, len);
         pszFmt++;
         continue;
       }
       /* Character */
       else if(*pszFmt == 'c') {
-        uint8_t cVal = (uint8_t) va_arg(args, int);
-        error |= state->hal_req_writeArray(&cVal,1);
+        uart_fmtPut(&fmt, (uint8_t) va_arg(args, int));
         pszFmt++;
         continue;
       }
-      /* Hex val - 16 bits */
-      else if(*pszFmt == 'x') {
-        uint16_t hexVal = (uint16_t) va_arg(args, int);
-        uint32_t i = 0;
-        uint32_t buffer[12] = {0};
-        do{
-          buffer[i++] = hexVal % HEX_VAL_MAX;
-          hexVal /= HEX_VAL_MAX;
-        }while(hexVal);
-        if(i%2!=0){
-          buffer[i++]=0;
-        }
-        if(i<2) {
-          buffer[i++]=0;
-        }
-        while(i > 0){
-          i--;
-          uint8_t ascii = 0;
-          error |= uart_hex2Ascii(buffer[i], &ascii);
-          error |= state->hal_req_writeArray(&ascii,1);
-        }
+      /* Hex val - 16 or 32 bits */
+      else if(*pszFmt == 'x' || *pszFmt == 'X') {
+        uint32_t hexVal = (*pszFmt == 'x') ? (uint16_t) va_arg(args, int) : va_arg(args, uint32_t);
+        uint8_t buffer[FORMAT_HEX32_LEN];
+        uint8_t len = 0;
+        format_hex32(hexVal, buffer, &len);
+        uart_fmtPutArray(&fmt, buffer, len);
         pszFmt++;
         continue;
       }
-      /* Hex val - 32 bits */
-      else if(*pszFmt == 'X') {
-        uint32_t hexVal = (uint32_t) va_arg(args, long);
-        uint32_t i = 0;
-        uint32_t buffer[12] = {0};
-        do{
-          buffer[i++] = hexVal % HEX_VAL_MAX;
-          hexVal /= HEX_VAL_MAX;
-        }while(hexVal);
-        if(i%2!=0){
-          buffer[i++]=0;
-        }
-        if(i<2) {
-          buffer[i++]=0;
-        }
-        while(i > 0){
-          i--;
-          uint8_t ascii = 0;
-          error |= uart_hex2Ascii(buffer[i], &ascii);
-          error |= state->hal_req_writeArray(&ascii,1);
-        }
-        pszFmt++;
-        continue;
-      }
-      /* Float */
+      /* Float, converted in fixed point */
       else if(*pszFmt == 'f' || *pszFmt == '.') {
         /* Get the precision */
         uint8_t prec = UART_FLOAT_DEFAULT_PREC;
@@ -476,114 +1007,65 @@ uint32_t uart_printf(MLJ_UART_S* state, const char *pszFmt,...) {
           ++pszFmt;
           prec = *pszFmt - '0';
           ++pszFmt;
+          if(prec > FORMAT_PREC_MAX){prec = FORMAT_PREC_MAX;}
         }
-        uint8_t buf[UART_FLOAT_BUFFER_SIZE];
-        size_t len =0u;
-        double diff = 0.0;
-        double val = va_arg(args, double);
-        /* Test for special values */
-        if(val != val){
-          uart_print(state, "NaN");
-          pszFmt++;
-          continue;
-        }
-        else if (val < -DBL_MAX){
-          uart_print(state, "-inf");
-          pszFmt++;
-          continue;
-        }
-        else if (val > DBL_MAX) {
-          uart_print(state, "+inf");
-          pszFmt++;
-          continue;
-        }
-        /* Test for large numbers */
-        if( (val > UART_MAX_FLOAT) || (val < -UART_MAX_FLOAT) ) {
-          uart_print(state, "*reqEXP");
-          pszFmt++;
-          continue;
-        }
-        /* Test for negative */
-        bool neg = false;
-        if(val < 0){
-          neg = true;
-          val = 0-val;
-        }
-        /* Ignore precision for now */
-        while((len < UART_FLOAT_BUFFER_SIZE) && (prec > 9u)){
-          buf[len++] = '0';
-          prec--;
-        }
-        int whole = (int) val;
-        double tmp = (val - whole) * pow10[prec];
-        unsigned long frac = (unsigned long) tmp;
-        diff = tmp - frac;
-        if(diff > 0.5){
-          ++frac;
-          /* Handle rollover, e.g. case 0.99 with prec 1 is 1.0 */
-          if(frac >= pow10[prec]){
-            frac = 0;
-            ++whole;
-          }
-        }
-        else if (diff < 0.5) {}
-        else if ((frac == 0u) || (frac &1u)){
-          /* if halfware round up if odd or if last digit is 0 */
-          ++frac;
-        }
-        if(prec == 0u){
-          diff = val - (double) whole;
-          if((!(diff < 0.5) || (diff > 0.5)) && (whole & 1)) {
-            /* Exactly 0.5 and ODD, round up */
-            /* 1.5 -> 2, 2.5->2 */
-            ++whole;
-          }
+        uint8_t buffer[FORMAT_FIXED_LEN];
+        uint8_t len = 0;
+        if(format_double(va_arg(args, double), prec, buffer, &len)){
+          /* Magnitude above FORMAT_FLOAT_MAX */
+          uart_fmtPutString(&fmt, "*reqEXP");
         }
         else {
-          unsigned int count  = prec;
-          /* Compute fractional part */
-          while (len < UART_FLOAT_BUFFER_SIZE) {
-            --count;
-            buf[len++] = (char) (48u + (frac % 10u));
-            if(!(frac /= 10u)){
-              break;
-            }
-          }
-          /* Add extra 0's */
-          while ((len < UART_FLOAT_BUFFER_SIZE) && (count-- > 0u)){
-            buf[len++] = '0';
-          }
-          if(len < UART_FLOAT_BUFFER_SIZE){
-            /* Add decimal */
-            buf[len++] = '.';
-          }
-        }
-        /* Do whole part, number is reversed */
-        while(len < UART_FLOAT_BUFFER_SIZE) {
-          buf[len++] = (char) (48 + (whole % 10));
-          if(!(whole /=10)){
-            break;
-          }
+          uart_fmtPutArray(&fmt, buffer, len);
         }
-        if(len < UART_FLOAT_BUFFER_SIZE){
-          if(neg){
-            buf[len++] = '-';
-          }
-        }
-        /* Print out */
-        error |= uart_write_reverse(state, buf, len);
         pszFmt++;
         continue;
       }
-      /* End of string */
-      if(pszFmt == NULL){break;}
     }
-    va_end(args);
+    uart_fmtFlush(&fmt);
+    error |= fmt.error;
   }
   return error;
 }
 
+/*******************************************************************************
+* Function Name: uart_fmtFlush()
+********************************************************************************
+* \brief
+*   Write the formatted bytes held by a uart_vformat() buffer with one 
+*   writer call. Stops writing after the first error.
+*
+* \param fmt [in/out]
+* Formatting buffer
+*******************************************************************************/
+static void uart_fmtFlush(uart_fmt_s *const fmt){
+  if((0 != fmt->len) && !fmt->error){
+    fmt->error |= fmt->write(fmt->ctx, fmt->buf, fmt->len);
+  }
+  fmt->len = 0;
+}
+
+/* Append one byte, flushing when the buffer is full */
+static void uart_fmtPut(uart_fmt_s *const fmt, uint8_t data){
+  fmt->buf[fmt->len++] = data;
+  if(fmt->len >= UART_PRINTF_BUFFER_LEN){uart_fmtFlush(fmt);}
+}
 
+/* Append a zero-terminated string */
+static void uart_fmtPutString(uart_fmt_s *const fmt, const char *str){
+  for(; *str != '\0'; str++){
+    uart_fmtPut(fmt, (uint8_t) *str);
+  }
+}
+
+/* Append the output of a format_*() call */
+static void uart_fmtPutArray(uart_fmt_s *const fmt, const uint8_t *array, uint8_t len){
+  for(uint8_t i = 0; i < len; i++){
+    uart_fmtPut(fmt, array[i]);
+  }
+}
+
+#ifndef MJL_UART_PRINT_DISABLE
 /*******************************************************************************
 * Function Name: uart_printHeader()
 ****************************************************************************//**
@@ -611,6 +1093,7 @@ uint32_t uart_printHeader(MLJ_UART_S* state, const char* name, const char *date,
   error |= uart_print(state, "\r\n**************************************\r\n");
   return error;
 }
+#endif /* MJL_UART_PRINT_DISABLE */
 
 /*******************************************************************************
 * Function Name: uart_hex2Ascii()
@@ -636,6 +1119,29 @@ uint32_t uart_hex2Ascii(uint8_t hex, uint8_t* ascii){
   return error;
 }
 
+/*******************************************************************************
+* Function Name: parseAsciiFloat()
+****************************************************************************//**
+* \brief Reads a float from ascii characters, e.g. received by the uart. 
+*   See parse_float() for the accepted syntax.
+*
+* \param buf [in]
+*  Characters to read, the whole buffer is the number
+*
+* \param len [in]
+*  Number of characters
+*
+* \param result [out]
+*  Value read
+*
+* \return
+*   The error code of the operation
+ *******************************************************************************/
+uint32_t parseAsciiFloat(uint8_t* buf, uint16_t len, float* result){
+  return parse_float(buf, len, result);
+}
+
+#ifndef MJL_UART_PRINT_DISABLE
 /*******************************************************************************
 * Function Name: uart_printError()
 ****************************************************************************//**
@@ -673,6 +1179,6 @@ uint32_t uart_printError(MLJ_UART_S* state, const char *description, uint32_t co
   }
   return error;
 }
-
+#endif /* MJL_UART_PRINT_DISABLE */
 
 /* [] END OF FILE */
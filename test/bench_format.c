@@ -0,0 +1,163 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: bench_format.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host benchmark of mjl_format against the digit loops uart_vprintf()
+*   used before it, kept in ref_format.c. For each kind of number it reports
+*   the time per number on the host, best of several runs, and the library
+*   calls per number the old loops make on a Cortex-M0, where each divmod
+*   call costs tens of cycles and each soft float call more. mjl_format makes
+*   none of either. make m0-calls lists the calls of both builds for
+*   -mcpu=cortex-m0. Integers must format identically. Doubles are compared
+*   and their differences counted, the old loops rounded in double, and must
+*   match snprintf(), which rounds the exact binary value as mjl_format does,
+*   apart from -0.0 which mjl_format writes without a sign as uart_printf did.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_format.h"
+#include "ref_format.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_NUMS    (1u << 18)  /* Numbers per run */
+#define BENCH_RUNS    (5)
+
+typedef enum {
+  BENCH_U32,
+  BENCH_I32,
+  BENCH_HEX32,
+  BENCH_DOUBLE_2,
+  BENCH_DOUBLE_6,
+  BENCH_KINDS,
+} BENCH_KIND_T;
+
+static const char *const bench_names[BENCH_KINDS] = {"%u", "%d", "%X", "%.2f", "%.6f"};
+static uint32_t ints[BENCH_NUMS];
+static double doubles[BENCH_NUMS];
+
+/* Random value with a uniformly distributed number of bits */
+static uint32_t bench_random(void){
+  uint32_t val = ((uint32_t) rand() << 16) ^ (uint32_t) rand() ^ ((uint32_t) rand() << 31);
+  return val >> (rand() % 32);
+}
+
+/* Format one number with the reference or the library */
+static void bench_format(BENCH_KIND_T kind, bool isRef, uint32_t idx, uint8_t *buf, uint8_t *len){
+  switch(kind){
+    case BENCH_U32:
+      if(isRef){ref_format_u32(ints[idx], buf, len);}
+      else {format_u32(ints[idx], buf, len);}
+      break;
+    case BENCH_I32:
+      if(isRef){ref_format_i32((int32_t) ints[idx], buf, len);}
+      else {format_i32((int32_t) ints[idx], buf, len);}
+      break;
+    case BENCH_HEX32:
+      if(isRef){ref_format_hex32(ints[idx], buf, len);}
+      else {format_hex32(ints[idx], buf, len);}
+      break;
+    default: {
+      uint8_t prec = (BENCH_DOUBLE_2 == kind) ? 2 : 6;
+      if(isRef){ref_format_double(doubles[idx], prec, buf, len);}
+      else {format_double(doubles[idx], prec, buf, len);}
+      break;
+    }
+  }
+}
+
+/* Format every number with call, outside the switch of bench_format() */
+#define BENCH_LOOP(call)  do{ \
+    for(uint32_t i = 0; i < BENCH_NUMS; i++){ \
+      call; \
+      sink += len + buf[0]; \
+    } \
+  }while(0)
+
+/* Nanoseconds per number */
+static double bench_time(BENCH_KIND_T kind, bool isRef){
+  uint8_t buf[32];
+  uint8_t len = 0;
+  uint32_t sink = 0;
+  uint64_t start = test_nowNs();
+  switch(kind){
+    case BENCH_U32:
+      if(isRef){BENCH_LOOP(ref_format_u32(ints[i], buf, &len));}
+      else {BENCH_LOOP(format_u32(ints[i], buf, &len));}
+      break;
+    case BENCH_I32:
+      if(isRef){BENCH_LOOP(ref_format_i32((int32_t) ints[i], buf, &len));}
+      else {BENCH_LOOP(format_i32((int32_t) ints[i], buf, &len));}
+      break;
+    case BENCH_HEX32:
+      if(isRef){BENCH_LOOP(ref_format_hex32(ints[i], buf, &len));}
+      else {BENCH_LOOP(format_hex32(ints[i], buf, &len));}
+      break;
+    default: {
+      uint8_t prec = (BENCH_DOUBLE_2 == kind) ? 2 : 6;
+      if(isRef){BENCH_LOOP(ref_format_double(doubles[i], prec, buf, &len));}
+      else {BENCH_LOOP(format_double(doubles[i], prec, buf, &len));}
+      break;
+    }
+  }
+  uint64_t ns = test_nowNs() - start;
+  /* Keep the results alive */
+  if(0 == sink){printf(" ");}
+  return (double) ns / BENCH_NUMS;
+}
+
+int main(void){
+  srand(7);
+  for(uint32_t i = 0; i < BENCH_NUMS; i++){
+    ints[i] = bench_random();
+    /* Up to 1e6, with a fraction of up to 32 bits */
+    doubles[i] = (double) (bench_random() % 1000000u) + ((double) bench_random() / 4294967296.0);
+    /* Every 8th a multiple of 1/128, exact ties at 2 and 6 decimals */
+    if(0 == (i % 8)){doubles[i] = (double) (bench_random() % 1000000u) + ((double) (rand() % 128) / 128.0);}
+    if(rand() & 1){doubles[i] = -doubles[i];}
+  }
+  printf("number   old ns   new ns   speedup   old M0 divmod/num   old M0 float/num   differences   printf mismatches\n");
+  for(uint8_t kind = 0; kind < BENCH_KINDS; kind++){
+    /* Count the calls and compare the text */
+    uint32_t differences = 0;
+    uint32_t mismatches = 0;
+    memset(&ref_formatCalls, 0, sizeof(ref_formatCalls));
+    for(uint32_t i = 0; i < BENCH_NUMS; i++){
+      uint8_t refBuf[32];
+      uint8_t buf[32];
+      uint8_t refLen = 0;
+      uint8_t len = 0;
+      bench_format(kind, true, i, refBuf, &refLen);
+      bench_format(kind, false, i, buf, &len);
+      if((refLen != len) || (0 != memcmp(refBuf, buf, len))){differences++;}
+      /* -0.0 is written as 0, printf writes -0 */
+      if((kind >= BENCH_DOUBLE_2) && (0.0 != doubles[i])){
+        char text[32];
+        int textLen = snprintf(text, sizeof(text), "%.*f", (BENCH_DOUBLE_2 == kind) ? 2 : 6, doubles[i]);
+        if((textLen != len) || (0 != memcmp(text, buf, len))){mismatches++;}
+      }
+    }
+    REF_FORMAT_CALLS_S calls = ref_formatCalls;
+    double old = 1e9;
+    double new = 1e9;
+    for(uint8_t run = 0; run < BENCH_RUNS; run++){
+      double ns = bench_time(kind, true);
+      if(ns < old){old = ns;}
+      ns = bench_time(kind, false);
+      if(ns < new){new = ns;}
+    }
+    /* Integers must not change, doubles must round as printf does */
+    if(kind < BENCH_DOUBLE_2){TEST_CHECK(0 == differences);}
+    TEST_CHECK(0 == mismatches);
+    printf("%-6s %8.2f %8.2f %8.2fx %19.2f %18.2f %13u %19u\n", bench_names[kind], old, new, old / new,
+      (double) calls.divmod / BENCH_NUMS, (double) calls.dfloat / BENCH_NUMS, differences, mismatches);
+  }
+  return test_report("bench_format");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,89 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: bench_ringPow2.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host benchmark of the power of two ring, which wraps its indices with
+*   a mask, against mjl_ringBuffer, which wraps them with %. Both move the same
+*   values in bursts of half the ring, the time per enqueue or dequeue is the
+*   best of several runs. On the host the % is a divide instruction, on a
+*   Cortex-M0 it is a call to __aeabi_uidivmod.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_ringBuffer.h"
+
+#define BENCH_OPS       (1u << 24)  /* Enqueues per run, as many dequeues */
+#define BENCH_RUNS      (5)
+#define BENCH_SIZE_MAX  (1024)
+
+static uint32_t buffer[BENCH_SIZE_MAX];
+
+/* Nanoseconds per operation of the generic ring, sum of the values read */
+static double bench_generic(uint16_t size, uint64_t *sum){
+  mjl_ring_s ring;
+  mjl_ring_cfg_s cfg = mjl_ring_cfg_default;
+  cfg.buffer = buffer;
+  cfg.size = size;
+  TEST_CHECK(0 == mjl_ringBuffer_init(&ring, &cfg));
+  uint16_t burst = size / 2;
+  uint32_t value = 0;
+  *sum = 0;
+  uint64_t start = test_nowNs();
+  for(uint32_t i = 0; i < BENCH_OPS; i += burst){
+    for(uint16_t j = 0; j < burst; j++){mjl_ringBuffer_enqueue(&ring, i + j);}
+    for(uint16_t j = 0; j < burst; j++){
+      mjl_ringBuffer_dequeue(&ring, &value);
+      *sum += value;
+    }
+  }
+  return (double) (test_nowNs() - start) / (2.0 * BENCH_OPS);
+}
+
+/* Nanoseconds per operation of the power of two ring */
+static double bench_pow2(uint16_t size, uint64_t *sum){
+  mjl_ring_pow2_s ring;
+  mjl_ring_cfg_s cfg = mjl_ring_cfg_default;
+  cfg.buffer = buffer;
+  cfg.size = size;
+  TEST_CHECK(0 == mjl_ringBuffer_pow2_init(&ring, &cfg));
+  uint16_t burst = size / 2;
+  uint32_t value = 0;
+  *sum = 0;
+  uint64_t start = test_nowNs();
+  for(uint32_t i = 0; i < BENCH_OPS; i += burst){
+    for(uint16_t j = 0; j < burst; j++){mjl_ringBuffer_pow2_enqueue(&ring, i + j);}
+    for(uint16_t j = 0; j < burst; j++){
+      mjl_ringBuffer_pow2_dequeue(&ring, &value);
+      *sum += value;
+    }
+  }
+  return (double) (test_nowNs() - start) / (2.0 * BENCH_OPS);
+}
+
+int main(void){
+  static const uint16_t sizes[] = {16, 64, 256, 1024};
+  printf("ring size   %% ns/op   mask ns/op   speedup\n");
+  for(uint8_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++){
+    double generic = 1e9;
+    double pow2 = 1e9;
+    uint64_t sumGeneric = 0;
+    uint64_t sumPow2 = 0;
+    for(uint8_t run = 0; run < BENCH_RUNS; run++){
+      double ns = bench_generic(sizes[i], &sumGeneric);
+      if(ns < generic){generic = ns;}
+      ns = bench_pow2(sizes[i], &sumPow2);
+      if(ns < pow2){pow2 = ns;}
+    }
+    /* Both rings must have moved the same values */
+    TEST_CHECK(sumGeneric == sumPow2);
+    printf("%9u %11.2f %12.2f %8.2fx\n", sizes[i], generic, pow2, generic / pow2);
+  }
+  return test_report("bench_ringPow2");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,118 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: bench_telemetry.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host benchmark of the binary telemetry against printing the same
+*   samples as ASCII lines with uart_printf(), both written to the simulated
+*   uart. For 16 bit, 32 bit and float samples it reports the samples per
+*   second the host produces, best of several runs, the bytes on the wire per
+*   sample and the samples per second a 115200 baud 8N1 line carries.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_telemetry.h"
+#include "hal_host.h"
+#include <stdlib.h>
+
+#define BENCH_SAMPLES     (1u << 18)  /* Samples per run */
+#define BENCH_RUNS        (5)
+#define BENCH_PER_FRAME   (32)
+#define BENCH_CHANNELS    (8)
+#define BENCH_LINE_BYTES_PER_S  (115200.0 / 10.0)
+
+typedef enum {
+  BENCH_I16,
+  BENCH_I32,
+  BENCH_FLOAT,
+  BENCH_KINDS,
+} BENCH_KIND_T;
+
+static const char *const bench_names[BENCH_KINDS] = {"int16", "int32", "float"};
+static int32_t ints[BENCH_SAMPLES];
+static float floats[BENCH_SAMPLES];
+static MLJ_UART_S uart;
+static MJL_TELEM_S telem;
+static uint8_t frame[MJL_TELEM_BUFFER_LEN(BENCH_PER_FRAME)];
+
+/* Random value with a uniformly distributed number of bits */
+static int32_t bench_random(void){
+  uint32_t val = ((uint32_t) rand() << 16) ^ (uint32_t) rand() ^ ((uint32_t) rand() << 31);
+  return (int32_t) (val >> (rand() % 32));
+}
+
+/* Write every sample, returns nanoseconds, bytes sent through bytes */
+static uint64_t bench_run(BENCH_KIND_T kind, bool isBinary, uint32_t *bytes){
+  HAL_HOST_UART_STATS_S stats;
+  uint32_t error = 0;
+  uart_hostSCB_reset();
+  uint64_t start = test_nowNs();
+  for(uint32_t i = 0; i < BENCH_SAMPLES; i++){
+    uint8_t channel = (uint8_t) (i % BENCH_CHANNELS);
+    if(isBinary){
+      switch(kind){
+        case BENCH_I16:   error |= mjl_telem_addI16(&telem, channel, (int16_t) ints[i]); break;
+        case BENCH_I32:   error |= mjl_telem_addI32(&telem, channel, ints[i]); break;
+        default:          error |= mjl_telem_addFloat(&telem, channel, floats[i]); break;
+      }
+    }
+    else {
+      switch(kind){
+        case BENCH_I16:   error |= uart_printf(&uart, "%u,%d\r\n", channel, (int16_t) ints[i]); break;
+        case BENCH_I32:   error |= uart_printf(&uart, "%u,%d\r\n", channel, ints[i]); break;
+        default:          error |= uart_printf(&uart, "%u,%f\r\n", channel, floats[i]); break;
+      }
+    }
+  }
+  if(isBinary){error |= mjl_telem_flush(&telem);}
+  uint64_t ns = test_nowNs() - start;
+  TEST_CHECK(0 == error);
+  uart_hostSCB_getStats(&stats);
+  *bytes = stats.bytes;
+  return ns;
+}
+
+int main(void){
+  MJL_UART_CFG_S uartCfg = uart_cfg_default;
+  uartCfg.hal_req_writeArray = uart_hostSCB_writeArrayBlocking;
+  uartCfg.hal_req_read = uart_hostSCB_read;
+  uartCfg.hal_opt_externalStart = uart_hostSCB_start;
+  TEST_CHECK(0 == uart_init(&uart, &uartCfg));
+  TEST_CHECK(0 == uart_start(&uart));
+  MJL_TELEM_CFG_S telemCfg = mjl_telem_cfg_default;
+  telemCfg.uart = &uart;
+  telemCfg.buffer = frame;
+  telemCfg.bufferLen = sizeof(frame);
+  telemCfg.opt_samplesPerFrame = BENCH_PER_FRAME;
+  TEST_CHECK(0 == mjl_telem_init(&telem, &telemCfg));
+
+  srand(11);
+  for(uint32_t i = 0; i < BENCH_SAMPLES; i++){
+    ints[i] = bench_random();
+    if(rand() & 1){ints[i] = -ints[i];}
+    floats[i] = (float) bench_random() / 1024.0f;
+  }
+  printf("%u samples, %u channels, %u samples per frame\n", BENCH_SAMPLES, BENCH_CHANNELS, BENCH_PER_FRAME);
+  printf("sample   path     host Msamples/s   bytes/sample   samples/s at 115200\n");
+  for(uint8_t kind = 0; kind < BENCH_KINDS; kind++){
+    for(int binary = 1; binary >= 0; binary--){
+      uint64_t best = UINT64_MAX;
+      uint32_t bytes = 0;
+      for(uint8_t run = 0; run < BENCH_RUNS; run++){
+        uint64_t ns = bench_run(kind, binary, &bytes);
+        if(ns < best){best = ns;}
+      }
+      double bytesPerSample = (double) bytes / BENCH_SAMPLES;
+      printf("%-8s %-8s %17.2f %14.2f %21.0f\n", bench_names[kind], binary ? "binary" : "ASCII",
+        (1e3 * BENCH_SAMPLES) / (double) best, bytesPerSample, BENCH_LINE_BYTES_PER_S / bytesPerSample);
+    }
+  }
+  TEST_CHECK(0 == telem.framesDropped);
+  return test_report("bench_telemetry");
+}
+
+/* [] END OF FILE */
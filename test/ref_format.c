@@ -0,0 +1,189 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: ref_format.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: The digit loops of uart_vprintf() before mjl_format, see ref_format.h.
+*   Digits are generated least significant first and reversed at the end, as
+*   uart_fmtPutReverse() did. REF_CALL() counts the library calls of each
+*   statement on a Cortex-M0 (gcc -O2, soft float): a / and % of the same
+*   operands are one divmod call, int to double conversions are calls too.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "ref_format.h"
+#include <float.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define REF_HEX_VAL_MAX         (16)
+#define REF_FLOAT_BUFFER_SIZE   (32u)
+#define REF_MAX_FLOAT           (1e9)
+#define REF_CALL(type, num)     (ref_formatCalls.type += (num))
+
+REF_FORMAT_CALLS_S ref_formatCalls = {0};
+
+static const double ref_pow10[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+static const uint8_t ref_hexAscii[REF_HEX_VAL_MAX+1] = "0123456789ABCDEF";
+
+/* Copy len reversed bytes forward, as uart_fmtPutReverse() */
+static void ref_putReverse(const uint8_t *array, uint16_t len, uint8_t *buf, uint8_t *bufLen){
+  uint8_t idx = 0;
+  while(len > 0){
+    len--;
+    buf[idx++] = array[len];
+  }
+  *bufLen = idx;
+}
+
+/* Copy a string, as uart_fmtPutString() */
+static void ref_putString(const char *str, uint8_t *buf, uint8_t *bufLen){
+  uint8_t idx = 0;
+  for(; *str != '\0'; str++){buf[idx++] = (uint8_t) *str;}
+  *bufLen = idx;
+}
+
+/* %u */
+void ref_format_u32(uint32_t val, uint8_t *buf, uint8_t *len){
+  uint32_t iVal = val;
+  uint8_t i = 0;
+  uint8_t buffer[10];
+  do{
+    REF_CALL(divmod, 1);
+    buffer[i++] = '0' + (iVal % 10);
+    iVal /= 10;
+  }while(iVal);
+  ref_putReverse(buffer, i, buf, len);
+}
+
+/* %d */
+void ref_format_i32(int32_t val, uint8_t *buf, uint8_t *len){
+  int32_t iVal = val;
+  uint32_t uVal = (iVal < 0) ? (0u - (uint32_t) iVal) : (uint32_t) iVal;
+  uint8_t i = 0;
+  uint8_t buffer[11];
+  do{
+    REF_CALL(divmod, 1);
+    buffer[i++] = '0' + (uVal % 10);
+    uVal /= 10;
+  }while(uVal);
+  if (iVal < 0){
+    buffer[i++] = '-';
+  }
+  ref_putReverse(buffer, i, buf, len);
+}
+
+/* %X, the divisor is a power of two so no calls */
+void ref_format_hex32(uint32_t val, uint8_t *buf, uint8_t *len){
+  uint32_t hexVal = val;
+  uint8_t i = 0;
+  uint8_t buffer[8];
+  do{
+    buffer[i++] = ref_hexAscii[hexVal % REF_HEX_VAL_MAX];
+    hexVal /= REF_HEX_VAL_MAX;
+  }while(hexVal);
+  if(i%2!=0){
+    buffer[i++]='0';
+  }
+  ref_putReverse(buffer, i, buf, len);
+}
+
+/* %.Nf */
+void ref_format_double(double val, uint8_t prec, uint8_t *buf, uint8_t *bufLen){
+  uint8_t out[REF_FLOAT_BUFFER_SIZE];
+  size_t len =0u;
+  double diff = 0.0;
+  /* NaN, -inf, +inf */
+  REF_CALL(dfloat, 1);
+  if(val != val){
+    ref_putString("NaN", buf, bufLen);
+    return;
+  }
+  REF_CALL(dfloat, 1);
+  if (val < -DBL_MAX){
+    ref_putString("-inf", buf, bufLen);
+    return;
+  }
+  REF_CALL(dfloat, 1);
+  if (val > DBL_MAX) {
+    ref_putString("+inf", buf, bufLen);
+    return;
+  }
+  REF_CALL(dfloat, 2);
+  if( (val > REF_MAX_FLOAT) || (val < -REF_MAX_FLOAT) ) {
+    ref_putString("*reqEXP", buf, bufLen);
+    return;
+  }
+  bool neg = false;
+  REF_CALL(dfloat, 1);
+  if(val < 0){
+    neg = true;
+    REF_CALL(dfloat, 1);
+    val = 0-val;
+  }
+  while((len < REF_FLOAT_BUFFER_SIZE) && (prec > 9u)){
+    out[len++] = '0';
+    prec--;
+  }
+  /* __aeabi_d2iz, __aeabi_i2d, __aeabi_dsub, __aeabi_dmul, __aeabi_d2uiz, __aeabi_ui2d, __aeabi_dsub */
+  REF_CALL(dfloat, 7);
+  int whole = (int) val;
+  double tmp = (val - whole) * ref_pow10[prec];
+  unsigned long frac = (unsigned long) tmp;
+  diff = tmp - frac;
+  REF_CALL(dfloat, 1);
+  if(diff > 0.5){
+    ++frac;
+    REF_CALL(dfloat, 2);
+    if(frac >= ref_pow10[prec]){
+      frac = 0;
+      ++whole;
+    }
+  }
+  else if (REF_CALL(dfloat, 1), diff < 0.5) {}
+  else if ((frac == 0u) || (frac &1u)){
+    ++frac;
+  }
+  if(prec == 0u){
+    REF_CALL(dfloat, 3);
+    diff = val - (double) whole;
+    if((!(diff < 0.5) || (REF_CALL(dfloat, 1), diff > 0.5)) && (whole & 1)) {
+      ++whole;
+    }
+  }
+  else {
+    unsigned int count  = prec;
+    while (len < REF_FLOAT_BUFFER_SIZE) {
+      --count;
+      REF_CALL(divmod, 1);
+      out[len++] = (char) (48u + (frac % 10u));
+      if(!(frac /= 10u)){
+        break;
+      }
+    }
+    while ((len < REF_FLOAT_BUFFER_SIZE) && (count-- > 0u)){
+      out[len++] = '0';
+    }
+    if(len < REF_FLOAT_BUFFER_SIZE){
+      out[len++] = '.';
+    }
+  }
+  while(len < REF_FLOAT_BUFFER_SIZE) {
+    REF_CALL(divmod, 1);
+    out[len++] = (char) (48 + (whole % 10));
+    if(!(whole /=10)){
+      break;
+    }
+  }
+  if(len < REF_FLOAT_BUFFER_SIZE){
+    if(neg){
+      out[len++] = '-';
+    }
+  }
+  ref_putReverse(out, (uint16_t) len, buf, bufLen);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,42 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: ref_format.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: The number formatting of uart_vprintf() before mjl_format, kept as
+*   the reference of bench_format.c. Each division and double operation is
+*   counted as the run time library call it becomes on a Cortex-M0, which has
+*   neither a divider nor an FPU.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef REF_FORMAT_H
+  #define REF_FORMAT_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdint.h>
+  /***************************************
+  * Structures
+  ***************************************/
+  /* Library calls made on a Cortex-M0 */
+  typedef struct {
+    uint32_t divmod;    /* __aeabi_uidivmod and __aeabi_idivmod */
+    uint32_t dfloat;    /* __aeabi_d* arithmetic, compares and conversions */
+  } REF_FORMAT_CALLS_S;
+
+  extern REF_FORMAT_CALLS_S ref_formatCalls;
+  /***************************************
+  * Function declarations
+  ***************************************/
+  void ref_format_u32(uint32_t val, uint8_t *buf, uint8_t *len);
+  void ref_format_i32(int32_t val, uint8_t *buf, uint8_t *len);
+  void ref_format_hex32(uint32_t val, uint8_t *buf, uint8_t *len);
+  void ref_format_double(double val, uint8_t prec, uint8_t *buf, uint8_t *len);
+
+#endif /* REF_FORMAT_H */
+/* [] END OF FILE */
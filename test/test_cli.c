@@ -0,0 +1,126 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_cli.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of mjl_cli line editing over the simulated uart RX ring,
+*   with the line length at and around the size of the line buffer
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_cli.h"
+#include "hal_host.h"
+#include <string.h>
+
+#define TEST_LINE_LEN   (8)     /* Longest line is 7 characters */
+
+static char test_arg[TEST_LINE_LEN];
+static uint8_t test_argc = 0;
+
+/* Handler keeping the first argument */
+static uint32_t test_cmdEcho(MJL_CLI_T *const cli, uint8_t argc, char *argv[]){
+  (void) cli;
+  test_argc = argc;
+  strcpy(test_arg, (argc > 1) ? argv[1] : "");
+  return 0;
+}
+
+static const MJL_CLI_CMD_S test_cmds[] = {
+  {"e", test_cmdEcho, "Keep the argument"},
+};
+
+static MLJ_UART_S uart;
+static MJL_CLI_S cli;
+static uint8_t rxBuffer[64];
+static char line[TEST_LINE_LEN];
+
+/* Receive a string, all at once or a byte per call of mjl_cli_process() */
+static void test_feed(const char *str, bool isBurst){
+  uint16_t len = (uint16_t) strlen(str);
+  uint16_t step = isBurst ? len : 1;
+  for(uint16_t i = 0; i < len; i += step){
+    uart_hostSCB_inject((const uint8_t*) &str[i], step);
+    while(uart_hostSCB_isRxIrqPending()){uart_rxIsr(&uart);}
+    TEST_CHECK(0 == mjl_cli_process(&cli));
+  }
+}
+
+/* Feed a line, check whether it ran and with which argument */
+static void test_line(const char *str, bool isBurst, bool isRun, const char *arg){
+  uint32_t linesRun = cli.linesRun;
+  test_arg[0] = '\0';
+  test_feed(str, isBurst);
+  TEST_CHECK(isRun == (linesRun + 1 == cli.linesRun));
+  if(isRun){
+    TEST_CHECK(0 == strcmp(arg, test_arg));
+    TEST_CHECK(0 == cli.lastError);
+  }
+  else {
+    TEST_CHECK(ERROR_PARAM == cli.lastError);
+  }
+}
+
+/* Check that the capture holds str */
+static bool test_isCaptured(const char *str){
+  uint16_t len = 0;
+  const uint8_t *cap = uart_hostSCB_getCapture(&len);
+  size_t strLen = strlen(str);
+  for(size_t i = 0; i + strLen <= len; i++){
+    if(0 == memcmp(&cap[i], str, strLen)){return true;}
+  }
+  return false;
+}
+
+int main(void){
+  uart_hostSCB_reset();
+  MJL_UART_CFG_S uartCfg = uart_cfg_default;
+  uartCfg.hal_req_writeArray = uart_hostSCB_writeArrayBlocking;
+  uartCfg.hal_req_read = uart_hostSCB_read;
+  uartCfg.hal_opt_externalStart = uart_hostSCB_start;
+  uartCfg.hal_opt_setRxIrq = uart_hostSCB_setRxIrq;
+  uartCfg.hal_opt_criticalEnter = critical_host_enter;
+  uartCfg.hal_opt_criticalExit = critical_host_exit;
+  uartCfg.opt_rxBuffer = rxBuffer;
+  uartCfg.opt_rxBufferLen = sizeof(rxBuffer);
+  TEST_CHECK(0 == uart_init(&uart, &uartCfg));
+  TEST_CHECK(0 == uart_start(&uart));
+
+  MJL_CLI_CFG_S cliCfg = mjl_cli_cfg_default;
+  cliCfg.uart = &uart;
+  cliCfg.cmds = test_cmds;
+  cliCfg.numCmds = 1;
+  cliCfg.lineBuffer = line;
+  cliCfg.lineBufferLen = sizeof(line);
+  TEST_CHECK(0 == mjl_cli_init(&cli, &cliCfg));
+
+  for(int burst = 0; burst < 2; burst++){
+    bool isBurst = (0 != burst);
+    /* Longest line, lineBufferLen - 1 characters */
+    test_line("e 12345\r", isBurst, true, "12345");
+    test_line("e 12345\r\n", isBurst, true, "12345");
+    /* Shorter and longer by one */
+    test_line("e 1234\n", isBurst, true, "1234");
+    test_line("e 123456\r", isBurst, false, NULL);
+    /* Far too long, then a line that fits */
+    test_line("e 123456789abcdef\r", isBurst, false, NULL);
+    test_line("e 54321\r", isBurst, true, "54321");
+    /* Backspace on a full line makes room again, not after an overflow */
+    test_line("e 12345\b6\r", isBurst, true, "12346");
+    test_line("e 123456\b\r", isBurst, false, NULL);
+  }
+  /* Full lines back to back in one read */
+  uint32_t linesRun = cli.linesRun;
+  test_feed("e 11111\re 22222\r", true);
+  TEST_CHECK(linesRun + 2 == cli.linesRun);
+  TEST_CHECK(0 == strcmp("22222", test_arg));
+  TEST_CHECK(6 == cli.linesRejected);
+  TEST_CHECK(test_isCaptured("Line too long"));
+  TEST_CHECK(0 == uart.rxOverflow);
+  return test_report("test_cli");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,56 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_host.h
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Checks shared by the host tests and benchmarks under test/, built and
+*   run with the host compiler by make host-test and make host-bench
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+/* Header Guard */
+#ifndef TEST_HOST_H
+  #define TEST_HOST_H
+  /***************************************
+  * Included files
+  ***************************************/
+  #include <stdint.h>
+  #include <stdio.h>
+  #include <time.h>
+  /***************************************
+  * Macro Definitions
+  ***************************************/
+  /* Count and report a failed condition, the test returns test_failures */
+  #define TEST_CHECK(cond)  do{ \
+      if(!(cond)){ \
+        test_failures++; \
+        printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+      } \
+    }while(0)
+
+  /***************************************
+  * Global variables
+  ***************************************/
+  static int test_failures = 0;
+
+  /***************************************
+  * Functions
+  ***************************************/
+  /* Monotonic time in nanoseconds, for the benchmarks */
+  static inline uint64_t test_nowNs(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t) ts.tv_sec * 1000000000u) + (uint64_t) ts.tv_nsec;
+  }
+
+  /* Print the result of a test, the exit code of main */
+  static inline int test_report(const char *name){
+    printf("%s: %s\n", name, test_failures ? "FAILED" : "passed");
+    return test_failures ? 1 : 0;
+  }
+
+#endif /* TEST_HOST_H */
+/* [] END OF FILE */
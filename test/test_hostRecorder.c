@@ -0,0 +1,202 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_hostRecorder.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the SPI bus recorder. An SSD1306 window update and an
+*   IS25LP ID read go through the driver taps, a MAX31856 register read
+*   through an MJL_SPI_S on the simulated SCB, and the summary must count
+*   exactly the bytes and chip selects each driver puts on the bus. The
+*   recording is saved, loaded and replayed without a slave model, the
+*   drivers must read the same values back with no MOSI byte differing.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_errors.h"
+#include "mjl_spi.h"
+#include "OLED_SSD1306.h"
+#include "FLASH_IS25LP.h"
+#include "max31856.h"
+#include "hal_host.h"
+#include "hal_hostRecorder.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_ID_OLED      (0)
+#define TEST_ID_FLASH     (1)
+#define TEST_ID_TEMP      (2)
+#define TEST_PIXELS       (128)   /* One page of the window */
+#define TEST_TEMP_VAL     (0x42)  /* Value of the register read */
+
+static MJL_SPI_S spi;
+static ssd1306_state_s oled;
+static FLASH_IS25_S flash;
+static FLASH_IS25_CFG_S flashCfg;
+static max31856_state_s temp;
+static display_window_s window = {.pageStart = 2, .pageEnd = 2, .colStart = 0, .colEnd = TEST_PIXELS - 1};
+static uint8_t pixels[TEST_PIXELS];
+
+/* Registers of the MAX31856, and the position in the current transaction */
+static uint8_t tempRegs[16];
+static uint8_t tempAddr = 0;
+static uint8_t tempPos = 0;
+/* Bytes of the IS25LP read ID command seen, 0 outside of one */
+static uint8_t flashPos = 0;
+
+/* Model of the slaves, the MAX31856 register file and the IS25LP ID */
+static uint8_t test_responder(uint8_t id, uint8_t mosi){
+  uint8_t miso = HAL_HOST_REC_MISO_IDLE;
+  if(TEST_ID_TEMP == id){
+    if(0 == tempPos){tempAddr = mosi;}
+    else {
+      uint8_t reg = (uint8_t) (((tempAddr & ~MAX31856_MASK_WRITEADDR) + tempPos - 1) & 0x0F);
+      if(tempAddr & MAX31856_MASK_WRITEADDR){tempRegs[reg] = mosi;}
+      else {miso = tempRegs[reg];}
+    }
+    tempPos++;
+  }
+  else if(TEST_ID_FLASH == id){
+    if(flashPos){flashPos++;}
+    else if(IS25_CMD_RDMDID == mosi){flashPos = 1;}
+    if((IS25_RDMDID_POS_MFG + 1) == flashPos){miso = IS25_ID_MFG;}
+    if((IS25_RDMDID_POS_DEV + 1) == flashPos){
+      miso = IS25_ID_DEV;
+      flashPos = 0;
+    }
+  }
+  return miso;
+}
+
+/* Chip select hook, a MAX31856 transaction starts with its address */
+static uint32_t test_csAssert(uint8_t id){
+  tempPos = 0;
+  return spi_hostRec_csAssert(id);
+}
+
+/* The three drivers on the bus, values read back through result */
+static uint32_t test_run(uint8_t *result){
+  uint32_t error = 0;
+  error |= SSD1306_writeWindowData(&oled, &window, pixels, TEST_PIXELS);
+  error |= max31856_readReg(&temp, MAX31856_LTCBH_ADDR, result);
+  error |= flash_is25_init(&flash, &flashCfg);
+  error |= flash_is25_start(&flash);
+  return error;
+}
+
+/* Check the summary of one slave */
+static void test_summary(uint8_t id, uint32_t transactions, uint32_t written, uint32_t read, uint32_t dcChanges){
+  HAL_HOST_REC_SUMMARY_S summary;
+  TEST_CHECK(0 == spi_hostRec_getSummary(id, &summary));
+  TEST_CHECK(transactions == summary.transactions);
+  TEST_CHECK(written == summary.bytesWritten);
+  TEST_CHECK(read == summary.bytesRead);
+  TEST_CHECK(dcChanges == summary.dcChanges);
+  TEST_CHECK(0 == summary.replayMismatch);
+  TEST_CHECK(0 == summary.replayUnderrun);
+}
+
+int main(int argc, char **argv){
+  (void) argc;
+  spi_hostSCB_reset();
+  spi_hostRec_reset();
+  spi_hostRec_setResponder(test_responder);
+  MJL_SPI_CFG_S spiCfg = spi_cfg_default;
+  spiCfg.req_hal_writeArray_blocking = spi_hostSCB_writeArray_blocking;
+  spiCfg.req_hal_read = spi_hostSCB_read;
+  spiCfg.req_hal_setActive = spi_hostRec_setActive;
+  spiCfg.req_hal_getRxBufferNum = spi_hostSCB_getRxBufferNum;
+  spiCfg.req_hal_getTxBufferNum = spi_hostSCB_getTxBufferNum;
+  spiCfg.req_hal_clearRxBuffer = spi_hostSCB_clearRxBuffer;
+  spiCfg.req_hal_clearTxBuffer = spi_hostSCB_clearTxBuffer;
+  spiCfg.opt_hal_externalStart = spi_hostSCB_start;
+  spiCfg.opt_hal_externalStop = spi_hostSCB_stop;
+  spiCfg.opt_hal_csAssert = test_csAssert;
+  spiCfg.opt_hal_csDeassert = spi_hostRec_csDeassert;
+  TEST_CHECK(0 == spi_init(&spi, &spiCfg));
+  TEST_CHECK(0 == spi_start(&spi));
+
+  ssd1306_cfg_s oledCfg = {
+    .fn_spi_writeArrayBlocking = spi_hostRec_writeArrayBlocking,
+    .fn_pin_reset_write = spi_hostRec_pinReset,
+    .fn_pin_dataCommand_write = spi_hostRec_pinDataCommand,
+    .fn_delayUs = spi_hostRec_delayUs,
+    .fn_spi_transferSegments = spi_hostRec_transferSegments,
+    .fullWindow = {.pageStart = 0, .pageEnd = 7, .colStart = 0, .colEnd = 127},
+    .spi_slaveId = TEST_ID_OLED,
+  };
+  TEST_CHECK(0 == SSD1306_init(&oled, &oledCfg));
+  flashCfg = flash_is25_cfg_default;
+  flashCfg.fn_delayUs = spi_hostRec_delayUs;
+  flashCfg.fn_spi_writeArrayBlocking = spi_hostRec_writeArrayBlocking;
+  flashCfg.fn_spi_readArrayBlocking = spi_hostRec_readArrayBlocking;
+  flashCfg.fn_spi_transferSegments = spi_hostRec_transferSegments;
+  flashCfg.slaveId = TEST_ID_FLASH;
+  max31856_cfg_s tempCfg = {.slaveId = TEST_ID_TEMP, .spi = &spi};
+  TEST_CHECK(0 == max31856_init(&temp, &tempCfg));
+  TEST_CHECK(0 == max31856_start(&temp));
+  tempRegs[MAX31856_LTCBH_ADDR] = TEST_TEMP_VAL;
+  for(uint16_t i = 0; i < TEST_PIXELS; i++){pixels[i] = (uint8_t) (i * 7u);}
+
+  /* Record, each driver counted on its own slave */
+  spi_hostRec_reset();
+  uint8_t result = 0;
+  TEST_CHECK(0 == test_run(&result));
+  TEST_CHECK(TEST_TEMP_VAL == result);
+  /* Window command and pixels under one chip select, D/C low then high */
+  test_summary(TEST_ID_OLED, 1, 6 + TEST_PIXELS, 0, 2);
+  /* Address and one byte clocked back in a single 2 byte exchange */
+  test_summary(TEST_ID_TEMP, 1, 2, 2, 0);
+  /* Reset enable, reset, then the command and address with the 2 ID bytes read */
+  test_summary(TEST_ID_FLASH, 3, 1 + 1 + IS25_RDMDID_LEN_CMD, IS25_RDMDID_LEN - IS25_RDMDID_LEN_CMD, 0);
+  test_summary(HAL_HOST_REC_ID_ALL, 5, 6 + TEST_PIXELS + 2 + 1 + 1 + IS25_RDMDID_LEN_CMD, 2 + IS25_RDMDID_LEN - IS25_RDMDID_LEN_CMD, 2);
+  /* The register read is a select, a chip select, 2 bytes and the release */
+  uint32_t numEvents = spi_hostRec_getNumEvents();
+  uint32_t tempEvents = 0;
+  for(uint32_t i = 0; i < numEvents; i++){
+    const HAL_HOST_REC_EVENT_S *event = spi_hostRec_getEvent(i);
+    if(TEST_ID_TEMP != event->id){continue;}
+    static const HAL_HOST_REC_TYPE_T types[] = {HAL_HOST_REC_SELECT, HAL_HOST_REC_CS_ASSERT, HAL_HOST_REC_EXCHANGE, HAL_HOST_REC_CS_DEASSERT};
+    TEST_CHECK((tempEvents < 4) && (types[tempEvents] == event->type));
+    if(HAL_HOST_REC_EXCHANGE == event->type){
+      const uint8_t *mosi;
+      const uint8_t *miso;
+      TEST_CHECK(0 == spi_hostRec_getData(event, &mosi, &miso));
+      TEST_CHECK((2 == event->len) && (MAX31856_LTCBH_ADDR == mosi[0]) && (TEST_TEMP_VAL == miso[1]));
+    }
+    tempEvents++;
+  }
+  TEST_CHECK(4 == tempEvents);
+
+  /* Save, load and replay without the slave model */
+  char path[256];
+  snprintf(path, sizeof(path), "%s.rec", argv[0]);
+  TEST_CHECK(0 == spi_hostRec_save(path));
+  spi_hostRec_setResponder(NULL);
+  TEST_CHECK(0 == spi_hostRec_load(path));
+  TEST_CHECK(spi_hostRec_isReplaying());
+  result = 0;
+  TEST_CHECK(0 == test_run(&result));
+  TEST_CHECK(TEST_TEMP_VAL == result);
+  TEST_CHECK(numEvents == spi_hostRec_getNumEvents());
+  test_summary(HAL_HOST_REC_ID_ALL, 5, 6 + TEST_PIXELS + 2 + 1 + 1 + IS25_RDMDID_LEN_CMD, 2 + IS25_RDMDID_LEN - IS25_RDMDID_LEN_CMD, 2);
+  remove(path);
+
+  /* Replayed again with 3 pixels changed, only those differ */
+  spi_hostRec_startReplay();
+  pixels[0] ^= 0x01;
+  pixels[50] ^= 0x80;
+  pixels[TEST_PIXELS - 1] ^= 0xFF;
+  TEST_CHECK(0 == test_run(&result));
+  HAL_HOST_REC_SUMMARY_S summary;
+  TEST_CHECK(0 == spi_hostRec_getSummary(HAL_HOST_REC_ID_ALL, &summary));
+  TEST_CHECK((3 == summary.replayMismatch) && (0 == summary.replayUnderrun));
+  TEST_CHECK(0 == spi_hostRec_getSummary(TEST_ID_OLED, &summary));
+  TEST_CHECK(3 == summary.replayMismatch);
+  return test_report("test_hostRecorder");
+}
+
+/* [] END OF FILE */
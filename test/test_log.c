@@ -0,0 +1,155 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_log.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the deferred binary log. Entries are written with
+*   MJL_LOG(), the frames captured from the simulated uart are decoded
+*   against the mjl_log section as tools/mjl_log_decode.py does, and the text
+*   must be what uart_printf() writes for the same calls. A string past the
+*   first 64 KiB of the section, beyond the 16 bit offset, is refused.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_log.h"
+#include "hal_host.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_RANDOM_ENTRIES   (60)
+
+/* Write an entry as a frame or as text, the same call for both */
+#define TEST_ENTRY(isLog, fmt, ...) \
+  ((isLog) ? MJL_LOG(&logState, fmt, ##__VA_ARGS__) : uart_printf(&uart, fmt, ##__VA_ARGS__))
+
+/* Provided by the linker for the section holding the format strings */
+extern const char __start_mjl_log[];
+extern const char __stop_mjl_log[];
+
+static MLJ_UART_S uart;
+static MJL_LOG_S logState;
+static uint32_t ticks = 0;
+static uint8_t frames[HAL_HOST_UART_CAPTURE_LEN];
+static uint8_t text[HAL_HOST_UART_CAPTURE_LEN];
+
+/* Ticks of the frames, advancing on every call */
+static uint32_t test_getTicks(void){
+  return ++ticks;
+}
+
+/* Copy out the capture since the last reset */
+static uint16_t test_capture(uint8_t *dest){
+  uint16_t len = 0;
+  const uint8_t *capture = uart_hostSCB_getCapture(&len);
+  memcpy(dest, capture, len);
+  uart_hostSCB_reset();
+  return len;
+}
+
+/* Entries with every conversion of uart_printf(), %s aside as a host pointer
+ * does not fit a word, then random ones */
+static uint32_t test_entries(bool isLog){
+  uint32_t error = 0;
+  error |= TEST_ENTRY(isLog, "boot\r\n");
+  error |= TEST_ENTRY(isLog, "x=%d y=%i z=%u\r\n", -5, INT32_MIN, UINT32_MAX);
+  error |= TEST_ENTRY(isLog, "%X %x %c %b %b\r\n", 0xDEADBEEFu, 0x1234, 'A', true, false);
+  error |= TEST_ENTRY(isLog, "t=%f v=%.3f w=%.0f\r\n", 1.5f, -2.25, 1234.5f);
+  error |= TEST_ENTRY(isLog, "%d%d%d%d%d%d%d%d\r\n", 1, 2, 3, 4, 5, 6, 7, 8);
+  srand(17);
+  for(uint8_t i = 0; i < TEST_RANDOM_ENTRIES; i++){
+    int32_t val = (int32_t) (((uint32_t) rand() << 16) ^ (uint32_t) rand());
+    float f = (float) (rand() - (RAND_MAX / 2)) / 1024.0f;
+    error |= TEST_ENTRY(isLog, "i=%d f=%.2f h=%X\r\n", val, f, (uint32_t) val);
+  }
+  return error;
+}
+
+/* Render one conversion of the format string, as uart_printf() would */
+static uint32_t test_render(const char *spec, uint8_t specLen, uint32_t word){
+  char fmt[5] = {0};
+  memcpy(fmt, spec, specLen);
+  float f;
+  memcpy(&f, &word, sizeof(f));
+  switch(spec[1]){
+    case 'd':
+    case 'i':   return uart_printf(&uart, fmt, (int32_t) word);
+    case 'f':
+    case '.':   return uart_printf(&uart, fmt, (double) f);
+    case 'b':
+    case 'c':   return uart_printf(&uart, fmt, (int) word);
+    default:    return uart_printf(&uart, fmt, word);
+  }
+}
+
+/* Decode the frames to text on the uart, false for anything that is not a
+ * frame of the expected ticks */
+static bool test_decode(const uint8_t *data, uint16_t len, uint32_t firstTicks){
+  uint16_t idx = 0;
+  uint32_t error = 0;
+  while(!error && (idx < len)){
+    if(((idx + 7u) > len) || (MJL_LOG_SYNC_TICKS != data[idx])){return false;}
+    uint16_t offset = (uint16_t) (data[idx + 1] | (data[idx + 2] << 8));
+    uint32_t frameTicks = data[idx + 3] | (data[idx + 4] << 8) | (data[idx + 5] << 16) | ((uint32_t) data[idx + 6] << 24);
+    if((offset >= (__stop_mjl_log - __start_mjl_log)) || (firstTicks++ != frameTicks)){return false;}
+    idx += 7;
+    /* Conversions take a word each, as counted by the decoder */
+    for(const char *fmt = &__start_mjl_log[offset]; !error && *fmt; fmt++){
+      uint8_t specLen = 0;
+      if(('%' == fmt[0]) && fmt[1] && strchr("sbudicxXf", fmt[1])){specLen = 2;}
+      else if(('%' == fmt[0]) && ('.' == fmt[1]) && fmt[2] && fmt[3]){specLen = 4;}
+      if(0 == specLen){
+        error |= uart_write(&uart, (uint8_t) *fmt);
+        continue;
+      }
+      if((idx + 4u) > len){return false;}
+      uint32_t word = data[idx] | (data[idx + 1] << 8) | (data[idx + 2] << 16) | ((uint32_t) data[idx + 3] << 24);
+      idx += 4;
+      error |= test_render(fmt, specLen, word);
+      fmt += specLen - 1u;
+    }
+  }
+  return !error;
+}
+
+int main(void){
+  MJL_UART_CFG_S uartCfg = uart_cfg_default;
+  uartCfg.hal_req_writeArray = uart_hostSCB_writeArrayBlocking;
+  uartCfg.hal_req_read = uart_hostSCB_read;
+  TEST_CHECK(0 == uart_init(&uart, &uartCfg));
+  TEST_CHECK(0 == uart_start(&uart));
+  MJL_LOG_CFG_S logCfg = mjl_log_cfg_default;
+  logCfg.uart = &uart;
+  logCfg.opt_getTicks = test_getTicks;
+  TEST_CHECK(0 == mjl_log_init(&logState, &logCfg));
+
+  /* Frames decoded against the section read as the text uart_printf() writes */
+  uart_hostSCB_reset();
+  TEST_CHECK(0 == test_entries(true));
+  uint16_t framesLen = test_capture(frames);
+  TEST_CHECK(0 == test_entries(false));
+  uint16_t textLen = test_capture(text);
+  TEST_CHECK(framesLen < textLen);
+  TEST_CHECK(test_decode(frames, framesLen, 1));
+  uint16_t decodedLen = 0;
+  const uint8_t *decoded = uart_hostSCB_getCapture(&decodedLen);
+  TEST_CHECK((textLen == decodedLen) && (0 == memcmp(text, decoded, textLen)));
+  TEST_CHECK(0 == logState.framesDropped);
+
+  /* The last offset a frame holds, then strings past it and in front of the section */
+  const uint32_t args[1] = {0};
+  uart_hostSCB_reset();
+  TEST_CHECK(0 == mjl_log_write(&logState, (const char *) ((uintptr_t) __start_mjl_log + UINT16_MAX), args, 0));
+  framesLen = test_capture(frames);
+  TEST_CHECK((7 == framesLen) && (0xFF == frames[1]) && (0xFF == frames[2]));
+  TEST_CHECK(ERROR_PARAM == mjl_log_write(&logState, (const char *) ((uintptr_t) __start_mjl_log + UINT16_MAX + 1u), args, 0));
+  TEST_CHECK(ERROR_PARAM == mjl_log_write(&logState, (const char *) ((uintptr_t) __start_mjl_log - 1u), args, 0));
+  TEST_CHECK(ERROR_PARAM == mjl_log_write(&logState, "not in the section", args, 0));
+  TEST_CHECK(0 == test_capture(frames));
+  return test_report("test_log");
+}
+
+/* [] END OF FILE */
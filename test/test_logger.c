@@ -0,0 +1,65 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_logger.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of mjl_logger_sinkUart() on the simulated uart. Each line,
+*   tag, text and line end, must reach the uart in a single write so lines
+*   from other contexts can not interleave, and a line longer than
+*   MJL_LOGGER_LINE_LEN must arrive whole in one write per buffer.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_logger.h"
+#include "hal_host.h"
+#include <string.h>
+
+static MLJ_UART_S uart;
+
+/* Check the writes and the text since the last reset */
+static void test_expect(uint32_t writes, const char *text){
+  HAL_HOST_UART_STATS_S stats;
+  uint16_t len = 0;
+  uart_hostSCB_getStats(&stats);
+  const uint8_t *capture = uart_hostSCB_getCapture(&len);
+  TEST_CHECK(writes == stats.writes);
+  TEST_CHECK((strlen(text) == len) && (0 == memcmp(capture, text, len)));
+}
+
+int main(void){
+  MJL_UART_CFG_S cfg = uart_cfg_default;
+  cfg.hal_req_writeArray = uart_hostSCB_writeArrayBlocking;
+  cfg.hal_req_read = uart_hostSCB_read;
+  TEST_CHECK(0 == uart_init(&uart, &cfg));
+  TEST_CHECK(0 == uart_start(&uart));
+  mjl_logger_setSink(mjl_logger_sinkUart, &uart);
+
+  /* One write per line */
+  uart_hostSCB_reset();
+  TEST_CHECK(0 == mjl_logger_write(MJL_LOGGER_LEVEL_INFO, "x=%d %s", -5, "ok"));
+  test_expect(1, "I: x=-5 ok\r\n");
+  uart_hostSCB_reset();
+  TEST_CHECK(0 == mjl_logger_write(MJL_LOGGER_LEVEL_ERROR, "%u ms", 100u));
+  TEST_CHECK(0 == mjl_logger_write(MJL_LOGGER_LEVEL_WARN, "%.2f", 1.25));
+  test_expect(2, "E: 100 ms\r\nW: 1.25\r\n");
+
+  /* A line filling the buffer exactly, "D: " and "\r\n" take 5, and one a byte longer */
+  char text[MJL_LOGGER_LINE_LEN];
+  char line[MJL_LOGGER_LINE_LEN + 8];
+  for(uint32_t writes = 1; writes <= 2; writes++){
+    uint16_t len = (uint16_t) (MJL_LOGGER_LINE_LEN - 6 + writes);
+    memset(text, 'a', len);
+    text[len] = '\0';
+    snprintf(line, sizeof(line), "D: %s\r\n", text);
+    uart_hostSCB_reset();
+    TEST_CHECK(0 == mjl_logger_write(MJL_LOGGER_LEVEL_DEBUG, "%s", text));
+    test_expect(writes, line);
+  }
+  return test_report("test_logger");
+}
+
+/* [] END OF FILE */
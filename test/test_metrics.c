@@ -0,0 +1,148 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_metrics.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the runtime metrics, built with MJL_METRICS_ENABLE for
+*   the whole library, see the makefile. Transfers on the simulated SPI and
+*   writes on the simulated uart must show in the counters as the wire saw
+*   them, and mjl_metrics_dump() must write every value in one frame with a
+*   valid checksum. test_metricsDisabled.c covers the build without it.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_errors.h"
+#include "mjl_metrics.h"
+#include "mjl_spi.h"
+#include "mjl_uart.h"
+#include "hal_host.h"
+#include <string.h>
+
+#ifndef MJL_METRICS_ENABLE
+  #error "test_metrics is built with MJL_METRICS_ENABLE"
+#endif
+
+#define TEST_LEN        (40)
+#define TEST_FRAME_LEN  (4 + (4 * MJL_METRIC_NUM) + 1)
+
+static MJL_SPI_S spi;
+static MLJ_UART_S uart;
+
+/* Slave answering the complement of each byte */
+static uint8_t test_responder(uint8_t id, uint8_t mosi){
+  (void) id;
+  return (uint8_t) ~mosi;
+}
+
+/* Current value of a metric */
+static uint32_t test_metric(MJL_METRIC_ID_T id){
+  uint32_t value = 0;
+  TEST_CHECK(0 == mjl_metrics_get(id, &value));
+  return value;
+}
+
+/* SPI counters against the wire of the simulated SCB */
+static void test_spi(void){
+  HAL_HOST_SPI_STATS_S stats;
+  uint8_t tx[TEST_LEN] = {0};
+  uint8_t rx[TEST_LEN];
+  for(uint8_t i = 0; i < 3; i++){TEST_CHECK(0 == spi_transfer(&spi, 0, tx, rx, TEST_LEN));}
+  MJL_SPI_SEG_S segs[2] = {
+    {.tx = tx, .rx = NULL, .len = 4, .fn_before = NULL, .arg = 0},
+    {.tx = tx, .rx = rx, .len = 16, .fn_before = NULL, .arg = 0},
+  };
+  TEST_CHECK(0 == spi_transferSegments(&spi, 0, segs, 2));
+  spi_hostSCB_getStats(&stats);
+  TEST_CHECK((3 * TEST_LEN) + 20 == test_metric(MJL_METRIC_SPI_BYTES));
+  TEST_CHECK(stats.bytesShifted == test_metric(MJL_METRIC_SPI_BYTES));
+  TEST_CHECK(4 == test_metric(MJL_METRIC_SPI_TRANSACTIONS));
+  TEST_CHECK(stats.selects == test_metric(MJL_METRIC_SPI_TRANSACTIONS));
+  TEST_CHECK(0 == test_metric(MJL_METRIC_SPI_SPINS));
+  /* A wire that does not shift spins until the exchange times out */
+  spi_hostSCB_setAutoShift(false);
+  TEST_CHECK(ERROR_TIMEOUT == spi_transfer(&spi, 0, tx, rx, TEST_LEN));
+  spi_hostSCB_setAutoShift(true);
+  TEST_CHECK((4 * TEST_LEN) + 20 == test_metric(MJL_METRIC_SPI_BYTES));
+  TEST_CHECK(5 == test_metric(MJL_METRIC_SPI_TRANSACTIONS));
+  TEST_CHECK(MJL_SPI_STALL_MAX == test_metric(MJL_METRIC_SPI_SPINS));
+  TEST_CHECK(0 == test_metric(MJL_METRIC_SPI_DMA_BYTES));
+}
+
+/* UART counters against the writes of the simulated uart */
+static void test_uart(void){
+  HAL_HOST_UART_STATS_S stats;
+  uint8_t data[10] = "0123456789";
+  TEST_CHECK(0 == uart_writeArray(&uart, data, sizeof(data)));
+  TEST_CHECK(0 == uart_write(&uart, '!'));
+  TEST_CHECK(0 == uart_printf(&uart, "x=%d\r\n", 42));
+  uart_hostSCB_getStats(&stats);
+  TEST_CHECK(17 == test_metric(MJL_METRIC_UART_BYTES));
+  TEST_CHECK(stats.bytes == test_metric(MJL_METRIC_UART_BYTES));
+  TEST_CHECK(3 == test_metric(MJL_METRIC_UART_WRITES));
+  TEST_CHECK(stats.writes == test_metric(MJL_METRIC_UART_WRITES));
+}
+
+/* One frame of every value, read before the dump counts its own write */
+static void test_dump(void){
+  uint32_t values[MJL_METRIC_NUM];
+  for(uint8_t i = 0; i < MJL_METRIC_NUM; i++){values[i] = test_metric((MJL_METRIC_ID_T) i);}
+  uart_hostSCB_reset();
+  TEST_CHECK(0 == mjl_metrics_dump(&uart));
+  uint16_t len = 0;
+  const uint8_t *frame = uart_hostSCB_getCapture(&len);
+  TEST_CHECK(TEST_FRAME_LEN == len);
+  if(TEST_FRAME_LEN != len){return;}
+  TEST_CHECK((MJL_METRICS_SYNC_0 == frame[0]) && (MJL_METRICS_SYNC_1 == frame[1]));
+  TEST_CHECK((MJL_METRICS_VERSION == frame[2]) && (MJL_METRIC_NUM == frame[3]));
+  for(uint8_t i = 0; i < MJL_METRIC_NUM; i++){
+    const uint8_t *word = &frame[4 + (4 * i)];
+    TEST_CHECK(values[i] == (word[0] | (word[1] << 8) | (word[2] << 16) | ((uint32_t) word[3] << 24)));
+  }
+  uint8_t checksum = 0;
+  for(uint16_t i = 0; i < (len - 1u); i++){checksum += frame[i];}
+  TEST_CHECK(checksum == frame[len - 1]);
+  TEST_CHECK(values[MJL_METRIC_UART_WRITES] + 1 == test_metric(MJL_METRIC_UART_WRITES));
+  TEST_CHECK(values[MJL_METRIC_UART_BYTES] + TEST_FRAME_LEN == test_metric(MJL_METRIC_UART_BYTES));
+}
+
+int main(void){
+  spi_hostSCB_reset();
+  spi_hostSCB_setResponder(test_responder);
+  MJL_SPI_CFG_S spiCfg = spi_cfg_default;
+  spiCfg.req_hal_writeArray_blocking = spi_hostSCB_writeArray_blocking;
+  spiCfg.req_hal_read = spi_hostSCB_read;
+  spiCfg.req_hal_setActive = spi_hostSCB_setActive;
+  spiCfg.req_hal_getRxBufferNum = spi_hostSCB_getRxBufferNum;
+  spiCfg.req_hal_getTxBufferNum = spi_hostSCB_getTxBufferNum;
+  spiCfg.req_hal_clearRxBuffer = spi_hostSCB_clearRxBuffer;
+  spiCfg.req_hal_clearTxBuffer = spi_hostSCB_clearTxBuffer;
+  spiCfg.opt_hal_externalStart = spi_hostSCB_start;
+  spiCfg.opt_hal_externalStop = spi_hostSCB_stop;
+  TEST_CHECK(0 == spi_init(&spi, &spiCfg));
+  TEST_CHECK(0 == spi_start(&spi));
+  MJL_UART_CFG_S uartCfg = uart_cfg_default;
+  uartCfg.hal_req_writeArray = uart_hostSCB_writeArrayBlocking;
+  uartCfg.hal_req_read = uart_hostSCB_read;
+  TEST_CHECK(0 == uart_init(&uart, &uartCfg));
+  TEST_CHECK(0 == uart_start(&uart));
+  uart_hostSCB_reset();
+
+  mjl_metrics_reset();
+  test_spi();
+  test_uart();
+  test_dump();
+
+  uint32_t value = 0;
+  TEST_CHECK(ERROR_PARAM == mjl_metrics_get(MJL_METRIC_NUM, &value));
+  TEST_CHECK(ERROR_POINTER == mjl_metrics_get(MJL_METRIC_SPI_BYTES, NULL));
+  TEST_CHECK(ERROR_POINTER == mjl_metrics_dump(NULL));
+  mjl_metrics_reset();
+  for(uint8_t i = 0; i < MJL_METRIC_NUM; i++){TEST_CHECK(0 == test_metric((MJL_METRIC_ID_T) i));}
+  return test_report("test_metrics");
+}
+
+/* [] END OF FILE */
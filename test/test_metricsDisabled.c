@@ -0,0 +1,57 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_metricsDisabled.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the runtime metrics left out, the default build. The
+*   update macros must expand to nothing, the registry must not be linked and
+*   the calls must report it missing while the drivers work as before.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_errors.h"
+#include "mjl_metrics.h"
+#include "mjl_uart.h"
+#include "hal_host.h"
+
+#ifdef MJL_METRICS_ENABLE
+  #error "test_metricsDisabled is built without MJL_METRICS_ENABLE"
+#endif
+
+/* Resolves to NULL unless some object still defines the registry */
+extern volatile uint32_t mjl_metrics[] __attribute__((weak));
+
+static MLJ_UART_S uart;
+
+int main(void){
+  MJL_UART_CFG_S cfg = uart_cfg_default;
+  cfg.hal_req_writeArray = uart_hostSCB_writeArrayBlocking;
+  cfg.hal_req_read = uart_hostSCB_read;
+  TEST_CHECK(0 == uart_init(&uart, &cfg));
+  TEST_CHECK(0 == uart_start(&uart));
+
+  /* The arguments are never evaluated, not even compiled: these names do not exist */
+  MJL_METRIC_ADD(MJL_METRIC_SPI_BYTES, test_undeclared);
+  MJL_METRIC_INC(test_undeclaredId);
+  MJL_METRIC_SET(test_undeclaredId, test_undeclared);
+  MJL_METRIC_MAX(test_undeclaredId, test_undeclared);
+  TEST_CHECK(NULL == mjl_metrics);
+
+  uart_hostSCB_reset();
+  uint32_t value = 0x5A5A5A5Au;
+  TEST_CHECK(ERROR_UNAVAILABLE == mjl_metrics_get(MJL_METRIC_UART_BYTES, &value));
+  TEST_CHECK(0x5A5A5A5Au == value);
+  mjl_metrics_reset();
+  TEST_CHECK(ERROR_UNAVAILABLE == mjl_metrics_dump(&uart));
+  TEST_CHECK(0 == uart_printf(&uart, "x=%d\r\n", 42));
+  uint16_t len = 0;
+  uart_hostSCB_getCapture(&len);
+  TEST_CHECK(6 == len);
+  return test_report("test_metricsDisabled");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,274 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_parse.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the mjl_parse conversions. parse_float must read the
+*   same float as strtof for random floats and for numbers halfway between
+*   two floats, parse_fixed must round to nearest, ties to even, within the
+*   range of its result, and every parser must report an empty buffer, a
+*   stray character and an overflow with its documented error, leaving the
+*   result unchanged.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_errors.h"
+#include "mjl_parse.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_NUM_FLOATS   (200000)
+#define TEST_NUM_FIXED    (200000)
+#define TEST_SENTINEL     (0x5A5A5A5Au)   /* Result left by a failed parse */
+
+static int floatMismatches = 0;
+
+/* 32 random bits */
+static uint32_t test_random(void){
+  return ((uint32_t) rand() << 16) ^ (uint32_t) rand() ^ ((uint32_t) rand() << 31);
+}
+
+/* Float of the given bits */
+static float test_float(uint32_t bits){
+  float val;
+  memcpy(&val, &bits, sizeof(val));
+  return val;
+}
+
+/* Parse a string as strtof does, the bits must match */
+static void test_floatStr(const char *str){
+  float val = 0.0f;
+  uint32_t error = parse_float((const uint8_t *) str, (uint16_t) strlen(str), &val);
+  float ref = strtof(str, NULL);
+  if(error || memcmp(&val, &ref, sizeof(val))){
+    if(floatMismatches < 10){printf("  parse_float(\"%s\") = %.9g, strtof %.9g\n", str, val, ref);}
+    floatMismatches++;
+  }
+}
+
+/* Number of significant digits of a decimal string */
+static int test_sigDigits(const char *str){
+  int num = 0;
+  int zeros = 0;
+  bool isLeading = true;
+  for(; *str && ('e' != *str); str++){
+    if((*str < '0') || (*str > '9')){continue;}
+    if(isLeading && ('0' == *str)){continue;}
+    isLeading = false;
+    if('0' == *str){zeros++;}
+    else {
+      num += zeros + 1;
+      zeros = 0;
+    }
+  }
+  return num;
+}
+
+/* Random floats, subnormals included, printed as the shortest round trip
+ * and with extra digits that parse_float has to round */
+static void test_floatRandom(void){
+  char str[64];
+  for(uint32_t i = 0; i < TEST_NUM_FLOATS; i++){
+    float val = test_float(test_random() & 0xFF7FFFFFu);
+    snprintf(str, sizeof(str), "%.9g", val);
+    test_floatStr(str);
+    snprintf(str, sizeof(str), "%.17e", val * (1.0 + ((double) (test_random() % 1000u) / 1e7)));
+    test_floatStr(str);
+    snprintf(str, sizeof(str), "%.6f", (double) (test_random() % 100000u) / 64.0);
+    test_floatStr(str);
+  }
+}
+
+/* Numbers halfway between two floats. The exact ones round to even, they are
+ * kept when their decimal fits in PARSE_MANT_DIGITS, the digits parse_float
+ * reads exactly. Those printed to 17 digits are just off halfway. */
+static void test_floatHalfway(void){
+  char str[96];
+  int numTies = 0;
+  for(uint32_t i = 0; i < TEST_NUM_FLOATS; i++){
+    float val = test_float(test_random() & 0x7F7FFFFEu);
+    float next = nextafterf(val, INFINITY);
+    double half = ((double) val + (double) next) / 2.0;
+    snprintf(str, sizeof(str), "%.17g", half);
+    test_floatStr(str);
+    snprintf(str, sizeof(str), "%.17g", -half);
+    test_floatStr(str);
+    /* Exact ties of floats from 2^9 to 2^63 have at most 19 digits */
+    int exp2 = 9 + (int) (test_random() % 55u);
+    val = ldexpf(1.0f + ((float) (test_random() & 0x7FFFFFu) / 8388608.0f), exp2);
+    next = nextafterf(val, INFINITY);
+    half = ((double) val + (double) next) / 2.0;
+    snprintf(str, sizeof(str), "%.*f", (exp2 < 24) ? (24 - exp2) : 0, half);
+    if(test_sigDigits(str) <= (int) PARSE_MANT_DIGITS){
+      test_floatStr(str);
+      numTies++;
+    }
+  }
+  TEST_CHECK(numTies > (TEST_NUM_FLOATS / 2));
+  test_floatStr("16777217");
+  test_floatStr("16777219");
+  test_floatStr("0.000000000000000000000000000000000000000000001401298464324817");
+  test_floatStr("3.4028235677973366e38");
+}
+
+/* Read a float, the error and the bits must match */
+static void test_floatErr(const char *str, uint32_t expect, uint32_t bits){
+  float val = test_float(TEST_SENTINEL);
+  TEST_CHECK(expect == parse_float((const uint8_t *) str, (uint16_t) strlen(str), &val));
+  float ref = test_float(bits);
+  TEST_CHECK(0 == memcmp(&val, &ref, sizeof(val)));
+}
+
+/* Exact fixed point of whole.frac / 10^fracDigits, ties to even */
+static int64_t test_fixedRef(bool neg, uint32_t whole, uint32_t frac, uint8_t fracDigits, uint8_t fracBits){
+  __uint128_t den = 1;
+  for(uint8_t i = 0; i < fracDigits; i++){den *= 10u;}
+  __uint128_t num = (((__uint128_t) whole * den) + frac) << fracBits;
+  __uint128_t mag = num / den;
+  __uint128_t rem = num % den;
+  if(((rem * 2u) > den) || (((rem * 2u) == den) && (mag & 1u))){mag++;}
+  return neg ? -(int64_t) mag : (int64_t) mag;
+}
+
+/* Random decimals with up to PARSE_FRAC_DIGITS fraction digits at every
+ * fracBits, matched against the exact rounding and the range of an int32_t */
+static void test_fixedRandom(void){
+  char str[48];
+  int mismatches = 0;
+  for(uint32_t i = 0; i < TEST_NUM_FIXED; i++){
+    uint8_t fracBits = (uint8_t) (test_random() % 32u);
+    uint8_t fracDigits = (uint8_t) (test_random() % (PARSE_FRAC_DIGITS + 1u));
+    bool neg = (test_random() & 1u);
+    uint32_t whole = test_random() >> (test_random() % 32u) >> fracBits;
+    uint32_t frac = 0;
+    int len = snprintf(str, sizeof(str), "%s%u", neg ? "-" : "", whole);
+    if(fracDigits){
+      uint32_t den = 1;
+      for(uint8_t j = 0; j < fracDigits; j++){den *= 10u;}
+      frac = test_random() % den;
+      snprintf(&str[len], sizeof(str) - (size_t) len, ".%0*u", fracDigits, frac);
+    }
+    int64_t ref = test_fixedRef(neg, whole, frac, fracDigits, fracBits);
+    bool isRange = (ref >= INT32_MIN) && (ref <= INT32_MAX);
+    int32_t val = (int32_t) TEST_SENTINEL;
+    uint32_t error = parse_fixed((const uint8_t *) str, (uint16_t) strlen(str), fracBits, &val);
+    if(isRange ? (error || (val != ref)) : ((ERROR_INVALID != error) || ((int32_t) TEST_SENTINEL != val))){
+      if(mismatches < 10){printf("  parse_fixed(\"%s\", %u) = %d, expected %lld\n", str, fracBits, val, (long long) ref);}
+      mismatches++;
+    }
+  }
+  TEST_CHECK(0 == mismatches);
+}
+
+/* Read a fixed point value, the error and the result must match */
+static void test_fixed(const char *str, uint8_t fracBits, uint32_t expect, int32_t result){
+  int32_t val = (int32_t) TEST_SENTINEL;
+  TEST_CHECK(expect == parse_fixed((const uint8_t *) str, (uint16_t) strlen(str), fracBits, &val));
+  TEST_CHECK(result == val);
+}
+
+/* Read an unsigned integer, the error and the result must match */
+static void test_u32(const char *str, uint32_t expect, uint32_t result){
+  uint32_t val = TEST_SENTINEL;
+  TEST_CHECK(expect == parse_u32((const uint8_t *) str, (uint16_t) strlen(str), &val));
+  TEST_CHECK(result == val);
+}
+
+/* Read a signed integer, the error and the result must match */
+static void test_i32(const char *str, uint32_t expect, int32_t result){
+  int32_t val = (int32_t) TEST_SENTINEL;
+  TEST_CHECK(expect == parse_i32((const uint8_t *) str, (uint16_t) strlen(str), &val));
+  TEST_CHECK(result == val);
+}
+
+/* Read a hexadecimal integer, the error and the result must match */
+static void test_hex32(const char *str, uint32_t expect, uint32_t result){
+  uint32_t val = TEST_SENTINEL;
+  TEST_CHECK(expect == parse_hex32((const uint8_t *) str, (uint16_t) strlen(str), &val));
+  TEST_CHECK(result == val);
+}
+
+int main(void){
+  srand(5);
+  test_floatRandom();
+  test_floatHalfway();
+  TEST_CHECK(0 == floatMismatches);
+
+  /* Floats out of range, without a number or with something after it */
+  test_floatErr("1e39", ERROR_INVALID, TEST_SENTINEL);
+  test_floatErr("-3.4028236e38", ERROR_INVALID, TEST_SENTINEL);
+  test_floatErr("3.4028235e38", ERROR_NONE, 0x7F7FFFFFu);
+  test_floatErr("1e-50", ERROR_NONE, 0x00000000u);
+  test_floatErr("-0", ERROR_NONE, 0x80000000u);
+  test_floatErr("", ERROR_UNAVAILABLE, TEST_SENTINEL);
+  test_floatErr("-", ERROR_VAL, TEST_SENTINEL);
+  test_floatErr(".", ERROR_VAL, TEST_SENTINEL);
+  test_floatErr("1.5x", ERROR_VAL, TEST_SENTINEL);
+  test_floatErr("1.5e", ERROR_VAL, TEST_SENTINEL);
+  test_floatErr("1.2.3", ERROR_VAL, TEST_SENTINEL);
+  test_floatErr("1e5 ", ERROR_VAL, TEST_SENTINEL);
+
+  /* Fixed point rounding, ties to even, later digits only break ties */
+  test_fixedRandom();
+  test_fixed("0.5", 0, ERROR_NONE, 0);
+  test_fixed("1.5", 0, ERROR_NONE, 2);
+  test_fixed("2.5", 0, ERROR_NONE, 2);
+  test_fixed("-2.5", 0, ERROR_NONE, -2);
+  test_fixed("2.5000000001", 0, ERROR_NONE, 3);
+  test_fixed("-2.4999999999", 0, ERROR_NONE, -2);
+  test_fixed(".375", 3, ERROR_NONE, 3);
+  test_fixed("-12.375", 16, ERROR_NONE, -811008);
+  test_fixed("0.1", 31, ERROR_NONE, 214748365);
+  /* Range of Q15.16 and Q0.31 */
+  test_fixed("32767.99998", 16, ERROR_NONE, INT32_MAX);
+  test_fixed("32767.999995", 16, ERROR_INVALID, (int32_t) TEST_SENTINEL);
+  test_fixed("32768", 16, ERROR_INVALID, (int32_t) TEST_SENTINEL);
+  test_fixed("-32768", 16, ERROR_NONE, INT32_MIN);
+  test_fixed("-32768.00001", 16, ERROR_INVALID, (int32_t) TEST_SENTINEL);
+  test_fixed("-1", 31, ERROR_NONE, INT32_MIN);
+  test_fixed("1", 31, ERROR_INVALID, (int32_t) TEST_SENTINEL);
+  test_fixed("2147483647", 0, ERROR_NONE, INT32_MAX);
+  test_fixed("4294967296", 0, ERROR_INVALID, (int32_t) TEST_SENTINEL);
+  test_fixed("1", 32, ERROR_PARAM, (int32_t) TEST_SENTINEL);
+  test_fixed("", 16, ERROR_UNAVAILABLE, (int32_t) TEST_SENTINEL);
+  test_fixed("-.", 16, ERROR_VAL, (int32_t) TEST_SENTINEL);
+  test_fixed("1.5.", 16, ERROR_VAL, (int32_t) TEST_SENTINEL);
+  test_fixed("1e3", 16, ERROR_VAL, (int32_t) TEST_SENTINEL);
+
+  /* Integers at their limits, empty and followed by a stray character */
+  test_u32("4294967295", ERROR_NONE, UINT32_MAX);
+  test_u32("+0", ERROR_NONE, 0);
+  test_u32("4294967296", ERROR_INVALID, TEST_SENTINEL);
+  test_u32("99999999999", ERROR_INVALID, TEST_SENTINEL);
+  test_u32("", ERROR_UNAVAILABLE, TEST_SENTINEL);
+  test_u32("+", ERROR_VAL, TEST_SENTINEL);
+  test_u32("-1", ERROR_VAL, TEST_SENTINEL);
+  test_u32("12a", ERROR_VAL, TEST_SENTINEL);
+  test_u32("4294967296a", ERROR_INVALID | ERROR_VAL, TEST_SENTINEL);
+  test_i32("2147483647", ERROR_NONE, INT32_MAX);
+  test_i32("-2147483648", ERROR_NONE, INT32_MIN);
+  test_i32("2147483648", ERROR_INVALID, (int32_t) TEST_SENTINEL);
+  test_i32("-2147483649", ERROR_INVALID, (int32_t) TEST_SENTINEL);
+  test_i32("-4294967296", ERROR_INVALID, (int32_t) TEST_SENTINEL);
+  test_i32("", ERROR_UNAVAILABLE, (int32_t) TEST_SENTINEL);
+  test_i32("-", ERROR_VAL, (int32_t) TEST_SENTINEL);
+  test_i32("-12 ", ERROR_VAL, (int32_t) TEST_SENTINEL);
+  test_i32("0x10", ERROR_VAL, (int32_t) TEST_SENTINEL);
+  test_hex32("0xFFFFFFFF", ERROR_NONE, UINT32_MAX);
+  test_hex32("deadBEEF", ERROR_NONE, 0xDEADBEEFu);
+  test_hex32("0X0", ERROR_NONE, 0);
+  test_hex32("0x100000000", ERROR_INVALID, TEST_SENTINEL);
+  test_hex32("", ERROR_UNAVAILABLE, TEST_SENTINEL);
+  test_hex32("0x", ERROR_VAL, TEST_SENTINEL);
+  test_hex32("0xG", ERROR_VAL, TEST_SENTINEL);
+  test_hex32("12g", ERROR_VAL, TEST_SENTINEL);
+  test_hex32("-1", ERROR_VAL, TEST_SENTINEL);
+  return test_report("test_parse");
+}
+
+/* [] END OF FILE */
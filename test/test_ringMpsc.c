@@ -0,0 +1,191 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_ringMpsc.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Stress test of mjl_ringMpsc. Every value carries its producer and a
+*   per producer sequence number, so the consumer sees any loss, duplicate or
+*   reordering.
+*     - pthread producers race for a small ring while one consumer drains it,
+*       once with the compare and swap and once with the critical section
+*       hooks (a mutex here) used on Cortex-M0/M0+
+*     - simulated interrupts enqueue from inside the critical section hooks,
+*       i.e. just before a producer claims its slot and between the claim and
+*       the commit, as nested interrupts on the target would
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_ringMpsc.h"
+#include <pthread.h>
+#include <sched.h>
+
+#define TEST_PRODUCERS    (4)
+#define TEST_PER_PRODUCER (250000u)
+#define TEST_RING_SIZE    (16)        /* Small, so the ring is full most of the time */
+#define TEST_SEQ_MASK     (0x00FFFFFFu)
+#define TEST_SPIN         (64u)       /* Failed calls between yields */
+#define TEST_STALL_NS     (10000000000ull)
+#define TEST_IRQ_ENTER_ID (1u)        /* Producer interrupting before the claim */
+#define TEST_IRQ_EXIT_ID  (2u)        /* Producer interrupting before the commit */
+
+/* What the consumer has seen */
+typedef struct {
+  uint32_t next[TEST_PRODUCERS];      /* Next sequence expected from each producer */
+  uint32_t received;
+  uint32_t bad;
+} TEST_CONSUMER_S;
+
+static mjl_ringMpsc_slot_s buffer[TEST_RING_SIZE];
+static mjl_ringMpsc_s ring;
+static pthread_mutex_t critical = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t fullRetries[TEST_PRODUCERS];
+static volatile bool isStalled = false;
+/* Simulated interrupts */
+static uint32_t irqSent[TEST_PRODUCERS];
+static uint32_t irqCalls = 0;
+static bool isInIrq = false;
+
+/* Check one value against the order of its producer */
+static void test_consume(TEST_CONSUMER_S *const consumer, uint32_t value){
+  uint32_t id = value >> 24;
+  uint32_t seq = value & TEST_SEQ_MASK;
+  if((id >= TEST_PRODUCERS) || (seq != consumer->next[id])){
+    if(consumer->bad++ < 4){printf("  value %08x, expected sequence %u\n", value, (id < TEST_PRODUCERS) ? consumer->next[id] : 0);}
+    if(id >= TEST_PRODUCERS){return;}
+  }
+  consumer->next[id] = seq + 1;
+  consumer->received++;
+}
+
+static void test_init(bool isCritical, uint32_t (*fn_enter)(void), void (*fn_exit)(uint32_t)){
+  mjl_ringMpsc_cfg_s cfg = mjl_ringMpsc_cfg_default;
+  cfg.buffer = buffer;
+  cfg.size = TEST_RING_SIZE;
+  if(isCritical){
+    cfg.fn_criticalEnter = fn_enter;
+    cfg.fn_criticalExit = fn_exit;
+  }
+  TEST_CHECK(0 == mjl_ringMpsc_init(&ring, &cfg));
+}
+
+static uint32_t test_mutexEnter(void){
+  pthread_mutex_lock(&critical);
+  return 0;
+}
+
+static void test_mutexExit(uint32_t intState){
+  (void) intState;
+  pthread_mutex_unlock(&critical);
+}
+
+/* Enqueue id << 24 | sequence, retrying while the ring is full */
+static void *test_producer(void *arg){
+  uint32_t id = (uint32_t) (uintptr_t) arg;
+  for(uint32_t seq = 0; (seq < TEST_PER_PRODUCER) && !isStalled;){
+    if(0 == mjl_ringMpsc_enqueue(&ring, (id << 24) | seq)){seq++;}
+    /* Spin for a while, so a producer is also preempted inside enqueue */
+    else if(0 == (++fullRetries[id] % TEST_SPIN)){
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+static void test_threads(bool isCritical){
+  test_init(isCritical, test_mutexEnter, test_mutexExit);
+  pthread_t threads[TEST_PRODUCERS];
+  isStalled = false;
+  for(uint32_t i = 0; i < TEST_PRODUCERS; i++){
+    fullRetries[i] = 0;
+    pthread_create(&threads[i], NULL, test_producer, (void*) (uintptr_t) i);
+  }
+  /* Consume, each producer's values must arrive once and in order */
+  TEST_CONSUMER_S consumer = {0};
+  uint32_t empty = 0;
+  uint64_t lastProgress = test_nowNs();
+  while(consumer.received < TEST_PRODUCERS * TEST_PER_PRODUCER){
+    uint32_t value = 0;
+    if(0 == mjl_ringMpsc_dequeue(&ring, &value)){
+      test_consume(&consumer, value);
+      lastProgress = test_nowNs();
+    }
+    else if(test_nowNs() - lastProgress > TEST_STALL_NS){
+      printf("  stalled after %u values\n", consumer.received);
+      isStalled = true;
+      break;
+    }
+    else if(0 == (++empty % TEST_SPIN)){
+      sched_yield();
+    }
+  }
+  for(uint32_t i = 0; i < TEST_PRODUCERS; i++){pthread_join(threads[i], NULL);}
+  uint32_t value = 0;
+  uint32_t retries = 0;
+  for(uint32_t i = 0; i < TEST_PRODUCERS; i++){
+    TEST_CHECK(TEST_PER_PRODUCER == consumer.next[i]);
+    retries += fullRetries[i];
+  }
+  TEST_CHECK(0 == consumer.bad);
+  TEST_CHECK(TEST_PRODUCERS * TEST_PER_PRODUCER == consumer.received);
+  /* Nothing left over */
+  TEST_CHECK(ERROR_STATE == mjl_ringMpsc_dequeue(&ring, &value));
+  printf("  %s: %u values from %u threads, %u full retries\n", isCritical ? "critical section" : "compare and swap",
+    consumer.received, TEST_PRODUCERS, retries);
+}
+
+/* Interrupt enqueuing a value of producer id, not nested in itself */
+static void test_irq(uint32_t id){
+  if(!isInIrq){
+    isInIrq = true;
+    if(0 == mjl_ringMpsc_enqueue(&ring, (id << 24) | irqSent[id])){irqSent[id]++;}
+    isInIrq = false;
+  }
+}
+
+/* Fires before the producer disables interrupts to claim its slot */
+static uint32_t test_irqEnter(void){
+  if(0 == (++irqCalls % 3)){test_irq(TEST_IRQ_ENTER_ID);}
+  return 0;
+}
+
+/* Fires once the slot is claimed, before it is committed */
+static void test_irqExit(uint32_t intState){
+  (void) intState;
+  if(0 == (irqCalls % 2)){test_irq(TEST_IRQ_EXIT_ID);}
+}
+
+static void test_interrupts(void){
+  test_init(true, test_irqEnter, test_irqExit);
+  TEST_CONSUMER_S consumer = {0};
+  uint32_t value = 0;
+  irqCalls = 0;
+  for(uint32_t i = 0; i < TEST_PRODUCERS; i++){irqSent[i] = 0;}
+  for(uint32_t seq = 0; seq < TEST_PER_PRODUCER;){
+    if(0 == mjl_ringMpsc_enqueue(&ring, seq)){seq++;}
+    /* Full, drain it */
+    else {
+      while(0 == mjl_ringMpsc_dequeue(&ring, &value)){test_consume(&consumer, value);}
+    }
+  }
+  while(0 == mjl_ringMpsc_dequeue(&ring, &value)){test_consume(&consumer, value);}
+  TEST_CHECK(0 == consumer.bad);
+  TEST_CHECK(TEST_PER_PRODUCER == consumer.next[0]);
+  TEST_CHECK(irqSent[TEST_IRQ_ENTER_ID] == consumer.next[TEST_IRQ_ENTER_ID]);
+  TEST_CHECK(irqSent[TEST_IRQ_EXIT_ID] == consumer.next[TEST_IRQ_EXIT_ID]);
+  TEST_CHECK((irqSent[TEST_IRQ_ENTER_ID] > 0) && (irqSent[TEST_IRQ_EXIT_ID] > 0));
+  printf("  nested interrupts: %u values, %u before a claim, %u before a commit\n", consumer.received,
+    irqSent[TEST_IRQ_ENTER_ID], irqSent[TEST_IRQ_EXIT_ID]);
+}
+
+int main(void){
+  test_threads(false);
+  test_threads(true);
+  test_interrupts();
+  return test_report("test_ringMpsc");
+}
+
+/* [] END OF FILE */
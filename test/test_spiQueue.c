@@ -0,0 +1,200 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_spiQueue.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the interrupt driven SPI transaction queue on the
+*   simulated SCB. Random transfers are queued while the wire shifts a few
+*   bytes at a time and the RX interrupt services the queue, with the CPU and
+*   with the DMA moving the chunks. Checks the data of every transfer, that
+*   each completes once and without error, in queue order within its
+*   priority, that high priority transfers run between the chunks of a low
+*   priority one and that stopping the driver returns queued transfers.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_errors.h"
+#include "mjl_spi.h"
+#include "hal_host.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_ROUNDS     (400)
+#define TEST_XFERS      (6)       /* Transfers queued per round */
+#define TEST_LEN_MAX    (600)
+#define TEST_CHUNK_LEN  (64)
+#define TEST_STEPS_MAX  (10000000)
+
+static MJL_SPI_S spi;
+static MJL_SPI_XFER_S xfers[TEST_XFERS];
+static uint8_t tx[TEST_XFERS][TEST_LEN_MAX];
+static uint8_t rx[TEST_XFERS][TEST_LEN_MAX];
+/* Completion record */
+static uint8_t completed[TEST_XFERS];
+static uint8_t numCompleted = 0;
+static uint32_t completeErrors = 0;
+
+/* Slave answering a function of its ID and the byte received */
+static uint8_t test_responder(uint8_t id, uint8_t mosi){
+  return (uint8_t) (mosi ^ (id * 0x11) ^ 0x5A);
+}
+
+static void test_complete(MJL_SPI_XFER_S *const xfer, uint32_t error){
+  completed[numCompleted++] = (uint8_t) (xfer - xfers);
+  completeErrors |= error;
+}
+
+static void test_init(bool isDma){
+  spi_hostSCB_reset();
+  spi_hostSCB_setResponder(test_responder);
+  MJL_SPI_CFG_S cfg = spi_cfg_default;
+  cfg.req_hal_writeArray_blocking = spi_hostSCB_writeArray_blocking;
+  cfg.req_hal_read = spi_hostSCB_read;
+  cfg.opt_hal_readArray = spi_hostSCB_readArray;
+  cfg.req_hal_setActive = spi_hostSCB_setActive;
+  cfg.req_hal_getRxBufferNum = spi_hostSCB_getRxBufferNum;
+  cfg.req_hal_getTxBufferNum = spi_hostSCB_getTxBufferNum;
+  cfg.req_hal_clearRxBuffer = spi_hostSCB_clearRxBuffer;
+  cfg.req_hal_clearTxBuffer = spi_hostSCB_clearTxBuffer;
+  cfg.opt_hal_externalStart = spi_hostSCB_start;
+  cfg.opt_hal_externalStop = spi_hostSCB_stop;
+  cfg.opt_hal_setIrq = spi_hostSCB_setIrq;
+  cfg.opt_hal_getTicks = spi_hostSCB_getTicks;
+  cfg.opt_chunkLen = TEST_CHUNK_LEN;
+  if(isDma){
+    cfg.opt_hal_dmaStart = spi_hostSCB_dmaStart;
+    cfg.opt_hal_dmaAbort = spi_hostSCB_dmaAbort;
+    cfg.opt_hal_criticalEnter = critical_host_enter;
+    cfg.opt_hal_criticalExit = critical_host_exit;
+  }
+  TEST_CHECK(0 == spi_init(&spi, &cfg));
+  TEST_CHECK(0 == spi_start(&spi));
+  spi_hostSCB_setAutoShift(false);
+}
+
+/* Shift the wire and run the interrupts, true once the queue is idle */
+static bool test_step(uint16_t num){
+  spi_hostSCB_shift(num);
+  if(spi_hostSCB_isDmaIrqPending()){spi_hostSCB_dmaIsr();}
+  if(spi_hostSCB_isIrqPending()){TEST_CHECK(0 == spi_serviceQueue(&spi));}
+  return spi_isQueueIdle(&spi);
+}
+
+static void test_random(bool isDma){
+  test_init(isDma);
+  srand(3);
+  for(int round = 0; round < TEST_ROUNDS; round++){
+    memset(xfers, 0, sizeof(xfers));
+    numCompleted = 0;
+    completeErrors = 0;
+    for(uint8_t k = 0; k < TEST_XFERS; k++){
+      MJL_SPI_XFER_S *xfer = &xfers[k];
+      xfer->id = (uint8_t) (rand() % 3);
+      xfer->len = (uint16_t) (1 + (rand() % TEST_LEN_MAX));
+      xfer->tx = (rand() % 4) ? tx[k] : NULL;
+      xfer->rx = (rand() % 5) ? rx[k] : NULL;
+      xfer->priority = (rand() % 3) ? MJL_SPI_PRIORITY_LOW : MJL_SPI_PRIORITY_HIGH;
+      xfer->isSplittable = (0 != (rand() % 2));
+      xfer->fn_complete = test_complete;
+      for(uint16_t i = 0; i < xfer->len; i++){tx[k][i] = (uint8_t) rand();}
+      memset(rx[k], 0xEE, TEST_LEN_MAX);
+    }
+    /* Queue the rest at random times while the first runs */
+    uint8_t queued = 0;
+    TEST_CHECK(0 == spi_queueTransfer(&spi, &xfers[queued++]));
+    uint32_t steps = 0;
+    while(!test_step((uint16_t) (1 + (rand() % 3))) || (queued < TEST_XFERS)){
+      if((queued < TEST_XFERS) && (0 == (rand() % 50))){
+        TEST_CHECK(0 == spi_queueTransfer(&spi, &xfers[queued++]));
+      }
+      if(++steps > TEST_STEPS_MAX){break;}
+    }
+    TEST_CHECK(steps <= TEST_STEPS_MAX);
+    TEST_CHECK(TEST_XFERS == numCompleted);
+    TEST_CHECK(0 == completeErrors);
+    for(uint8_t k = 0; k < TEST_XFERS; k++){
+      MJL_SPI_XFER_S *xfer = &xfers[k];
+      TEST_CHECK(!spi_isTransferBusy(xfer));
+      if(NULL != xfer->rx){
+        for(uint16_t i = 0; i < xfer->len; i++){
+          uint8_t mosi = (NULL != xfer->tx) ? xfer->tx[i] : 0;
+          if(xfer->rx[i] != test_responder(xfer->id, mosi)){
+            TEST_CHECK(xfer->rx[i] == test_responder(xfer->id, mosi));
+            break;
+          }
+        }
+      }
+    }
+    /* First come first served within a priority */
+    for(uint8_t i = 0; i < numCompleted; i++){
+      for(uint8_t j = i + 1; j < numCompleted; j++){
+        if(xfers[completed[i]].priority == xfers[completed[j]].priority){
+          TEST_CHECK(completed[i] < completed[j]);
+        }
+      }
+    }
+  }
+  HAL_HOST_SPI_STATS_S stats;
+  spi_hostSCB_getStats(&stats);
+  TEST_CHECK(0 == stats.rxOverflow);
+  TEST_CHECK(isDma == (0 != stats.dmaStarts));
+  printf("  %s: %u transfers, %u bytes shifted, %u DMA starts\n", isDma ? "DMA" : "CPU",
+    TEST_ROUNDS * TEST_XFERS, stats.bytesShifted, stats.dmaStarts);
+}
+
+/* A high priority transfer does not wait for a long splittable one */
+static void test_priority(bool isDma){
+  test_init(isDma);
+  memset(xfers, 0, sizeof(xfers));
+  numCompleted = 0;
+  completeErrors = 0;
+  xfers[0].len = 8 * TEST_CHUNK_LEN;
+  xfers[0].isSplittable = true;
+  xfers[0].fn_complete = test_complete;
+  xfers[1].id = 1;
+  xfers[1].len = 4;
+  xfers[1].priority = MJL_SPI_PRIORITY_HIGH;
+  xfers[1].fn_complete = test_complete;
+  TEST_CHECK(0 == spi_queueTransfer(&spi, &xfers[0]));
+  test_step(TEST_CHUNK_LEN / 2);
+  TEST_CHECK(0 == spi_queueTransfer(&spi, &xfers[1]));
+  uint32_t steps = 0;
+  while(!test_step(1) && (++steps < TEST_STEPS_MAX)){}
+  TEST_CHECK(2 == numCompleted);
+  TEST_CHECK((1 == completed[0]) && (0 == completed[1]));
+  TEST_CHECK(0 == completeErrors);
+}
+
+/* Stopping returns queued transfers with ERROR_STOPPED */
+static void test_stop(bool isDma){
+  test_init(isDma);
+  memset(xfers, 0, sizeof(xfers));
+  numCompleted = 0;
+  completeErrors = 0;
+  for(uint8_t k = 0; k < 2; k++){
+    xfers[k].len = 100;
+    xfers[k].fn_complete = test_complete;
+    TEST_CHECK(0 == spi_queueTransfer(&spi, &xfers[k]));
+  }
+  test_step(10);
+  spi_stop(&spi);
+  TEST_CHECK(2 == numCompleted);
+  TEST_CHECK(ERROR_STOPPED & completeErrors);
+  TEST_CHECK(!spi_isTransferBusy(&xfers[0]) && !spi_isTransferBusy(&xfers[1]));
+  TEST_CHECK(ERROR_STOPPED == spi_queueTransfer(&spi, &xfers[0]));
+}
+
+int main(void){
+  for(int dma = 0; dma < 2; dma++){
+    test_random(0 != dma);
+    test_priority(0 != dma);
+    test_stop(0 != dma);
+  }
+  return test_report("test_spiQueue");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_spiTransfer.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the blocking SPI transfers on the simulated SCB. A
+*   transfer on a wire that shifts returns the slave's answer, one on a wire
+*   that stopped gives up with ERROR_TIMEOUT instead of hanging, and the bus
+*   works again once the wire moves. Once a slave is registered with its
+*   settings, a slave that is not is refused instead of running with them.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_errors.h"
+#include "mjl_spi.h"
+#include "hal_host.h"
+#include <string.h>
+
+#define TEST_LEN    (40)
+
+static MJL_SPI_S spi;
+
+/* Slave answering the complement of each byte */
+static uint8_t test_responder(uint8_t id, uint8_t mosi){
+  (void) id;
+  return (uint8_t) ~mosi;
+}
+
+/* Transfer TEST_LEN bytes and check the answer when it completes */
+static uint32_t test_transfer(uint8_t id){
+  uint8_t tx[TEST_LEN];
+  uint8_t rx[TEST_LEN];
+  for(uint8_t i = 0; i < TEST_LEN; i++){tx[i] = i;}
+  memset(rx, 0, sizeof(rx));
+  uint32_t error = spi_transfer(&spi, id, tx, rx, TEST_LEN);
+  if(!error){
+    for(uint8_t i = 0; i < TEST_LEN; i++){TEST_CHECK(rx[i] == test_responder(id, tx[i]));}
+  }
+  return error;
+}
+
+int main(void){
+  spi_hostSCB_reset();
+  spi_hostSCB_setResponder(test_responder);
+  MJL_SPI_CFG_S cfg = spi_cfg_default;
+  cfg.req_hal_writeArray_blocking = spi_hostSCB_writeArray_blocking;
+  cfg.req_hal_read = spi_hostSCB_read;
+  cfg.req_hal_setActive = spi_hostSCB_setActive;
+  cfg.req_hal_getRxBufferNum = spi_hostSCB_getRxBufferNum;
+  cfg.req_hal_getTxBufferNum = spi_hostSCB_getTxBufferNum;
+  cfg.req_hal_clearRxBuffer = spi_hostSCB_clearRxBuffer;
+  cfg.req_hal_clearTxBuffer = spi_hostSCB_clearTxBuffer;
+  cfg.opt_hal_externalStart = spi_hostSCB_start;
+  cfg.opt_hal_externalStop = spi_hostSCB_stop;
+  cfg.opt_hal_configure = spi_hostSCB_configure;
+  TEST_CHECK(0 == spi_init(&spi, &cfg));
+  TEST_CHECK(0 == spi_start(&spi));
+
+  TEST_CHECK(0 == test_transfer(0));
+  /* A wire that does not shift times the transfer out */
+  spi_hostSCB_setAutoShift(false);
+  TEST_CHECK(ERROR_TIMEOUT == test_transfer(0));
+  TEST_CHECK(0 == spi_hostSCB_getTxBufferNum());
+  /* and the next transfer starts clean */
+  spi_hostSCB_setAutoShift(true);
+  TEST_CHECK(0 == test_transfer(0));
+
+  /* Slave 1 registered in mode 1 at 5 MHz, slave 0 may no longer use the bus */
+  const MJL_SPI_DEVICE_S device = {.id = 1, .mode = MJL_SPI_MODE_1, .maxClockHz = 5000000u, .csActiveHigh = false};
+  TEST_CHECK(0 == spi_registerDevice(&spi, &device));
+  TEST_CHECK(0 == test_transfer(1));
+  TEST_CHECK(&device == spi_hostSCB_getDevice());
+  TEST_CHECK(ERROR_PARAM == test_transfer(0));
+  MJL_SPI_SEG_S seg = {.tx = NULL, .rx = NULL, .len = 1, .fn_before = NULL, .arg = 0};
+  TEST_CHECK(ERROR_PARAM == spi_transferSegments(&spi, 0, &seg, 1));
+  MJL_SPI_XFER_S xfer = {.id = 0, .len = 1};
+  TEST_CHECK(ERROR_PARAM == spi_queueTransfer(&spi, &xfer));
+  TEST_CHECK(&device == spi_hostSCB_getDevice());
+  return test_report("test_spiTransfer");
+}
+
+/* [] END OF FILE */
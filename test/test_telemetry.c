@@ -0,0 +1,228 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_telemetry.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the binary telemetry. Random payloads are COBS encoded
+*   and decoded back, frames of random samples are captured from the
+*   simulated uart and decoded as tools/mjl_telemetry_decode.py does, with
+*   their CRC-16/CCITT-FALSE, sequence numbers and samples checked. A frame
+*   with any byte corrupted or cut short must be rejected.
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_telemetry.h"
+#include "hal_host.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_PAYLOADS     (4000)
+#define TEST_PAYLOAD_MAX  (700)
+#define TEST_FRAMES       (500)
+#define TEST_SAMPLES_MAX  (64)
+
+/* One sample added to a frame */
+typedef struct {
+  uint8_t channel;
+  MJL_TELEM_KIND_T kind;
+  uint32_t value;
+} TEST_SAMPLE_S;
+
+static MLJ_UART_S uart;
+static MJL_TELEM_S telem;
+static uint8_t frame[MJL_TELEM_BUFFER_LEN(TEST_SAMPLES_MAX)];
+static uint32_t ticks = 0;
+
+/* 32 random bits */
+static uint32_t test_random(void){
+  return ((uint32_t) rand() << 16) ^ (uint32_t) rand() ^ ((uint32_t) rand() << 31);
+}
+
+/* Ticks of the frames, advancing on every call */
+static uint32_t test_getTicks(void){
+  ticks += 1000u;
+  return ticks;
+}
+
+/* CRC-16/CCITT-FALSE a bit at a time, as the decoder computes it */
+static uint16_t test_crc16(const uint8_t *data, uint16_t len){
+  uint16_t crc = MJL_TELEM_CRC_INIT;
+  for(uint16_t i = 0; i < len; i++){
+    crc ^= (uint16_t) (data[i] << 8);
+    for(uint8_t bit = 0; bit < 8; bit++){
+      crc = (crc & 0x8000u) ? (uint16_t) ((crc << 1) ^ 0x1021u) : (uint16_t) (crc << 1);
+    }
+  }
+  return crc;
+}
+
+/* Raw bytes of one COBS frame without its delimiter, false when malformed */
+static bool test_cobsDecode(const uint8_t *data, uint16_t len, uint8_t *out, uint16_t *outLen){
+  uint16_t idx = 0;
+  *outLen = 0;
+  while(idx < len){
+    uint8_t code = data[idx];
+    if((0 == code) || ((idx + code) > len)){return false;}
+    memcpy(&out[*outLen], &data[idx + 1], code - 1u);
+    *outLen += code - 1u;
+    idx += code;
+    if((code < 0xFF) && (idx < len)){out[(*outLen)++] = 0;}
+  }
+  return true;
+}
+
+/* Decode one frame as the host tool does, the samples must be those sent */
+static bool test_frameCheck(const uint8_t *data, uint16_t len, uint16_t seq, uint32_t frameTicks,
+    const TEST_SAMPLE_S *samples, uint8_t count){
+  uint8_t raw[MJL_TELEM_BUFFER_LEN(TEST_SAMPLES_MAX)];
+  uint16_t rawLen = 0;
+  if((len > sizeof(raw)) || !test_cobsDecode(data, len, raw, &rawLen)){return false;}
+  if((rawLen < (MJL_TELEM_HEADER_LEN + MJL_TELEM_CRC_LEN)) || (MJL_TELEM_VERSION != raw[0])){return false;}
+  uint16_t crcLen = rawLen - MJL_TELEM_CRC_LEN;
+  if(test_crc16(raw, crcLen) != (raw[crcLen] | (raw[crcLen + 1] << 8))){return false;}
+  bool isMatch = (seq == (raw[1] | (raw[2] << 8)));
+  isMatch &= (frameTicks == (raw[3] | (raw[4] << 8) | (raw[5] << 16) | ((uint32_t) raw[6] << 24)));
+  isMatch &= (count == raw[7]);
+  uint16_t idx = MJL_TELEM_HEADER_LEN;
+  for(uint8_t i = 0; isMatch && (i < count); i++){
+    uint8_t valueLen = (MJL_TELEM_KIND_I16 == samples[i].kind) ? 2 : 4;
+    if((idx + 2 + valueLen) > crcLen){return false;}
+    uint32_t value = 0;
+    for(uint8_t j = 0; j < valueLen; j++){value |= (uint32_t) raw[idx + 2 + j] << (8 * j);}
+    isMatch &= (samples[i].channel == raw[idx]) && (samples[i].kind == raw[idx + 1]);
+    isMatch &= (value == ((MJL_TELEM_KIND_I16 == samples[i].kind) ? (samples[i].value & 0xFFFFu) : samples[i].value));
+    idx += 2 + valueLen;
+  }
+  return isMatch && (idx == crcLen);
+}
+
+/* Random payloads with few, many or no zeros, encoded in place and decoded */
+static void test_cobs(void){
+  static uint8_t payload[TEST_PAYLOAD_MAX];
+  static uint8_t buffer[TEST_PAYLOAD_MAX + 2 + (TEST_PAYLOAD_MAX / 254) + 1];
+  static uint8_t decoded[TEST_PAYLOAD_MAX];
+  static const uint32_t zeroOdds[] = {2u, 256u, 0u};   /* One zero in this many bytes, 0 for none */
+  int mismatches = 0;
+  for(uint32_t i = 0; i < TEST_PAYLOADS; i++){
+    uint16_t len = (uint16_t) (test_random() % (TEST_PAYLOAD_MAX + 1u));
+    uint32_t odds = zeroOdds[i % 3];
+    for(uint16_t j = 0; j < len; j++){
+      payload[j] = (uint8_t) test_random();
+      if(odds && (0 == (test_random() % odds))){payload[j] = 0;}
+      else if(0 == payload[j]){payload[j] = 0xFF;}
+    }
+    uint16_t start = 1 + (len / 254);
+    memcpy(&buffer[start], payload, len);
+    uint16_t encLen = mjl_telem_cobsEncode(buffer, start, len);
+    /* Only the delimiter is zero, then the overhead is at most 1 + len / 254 */
+    bool isMatch = (encLen <= (len + 2 + (len / 254))) && (0 == buffer[encLen - 1]);
+    isMatch &= (NULL == memchr(buffer, 0, encLen - 1u));
+    uint16_t decLen = 0;
+    isMatch = isMatch && test_cobsDecode(buffer, encLen - 1u, decoded, &decLen);
+    isMatch = isMatch && (len == decLen) && (0 == memcmp(payload, decoded, len));
+    if(!isMatch){mismatches++;}
+  }
+  TEST_CHECK(0 == mismatches);
+}
+
+/* The library CRC against the check value and the bitwise reference */
+static void test_crc(void){
+  static const uint8_t check[] = "123456789";
+  TEST_CHECK(0x29B1u == mjl_telem_crc16(MJL_TELEM_CRC_INIT, check, 9));
+  TEST_CHECK(0x29B1u == test_crc16(check, 9));
+  uint8_t data[64];
+  int mismatches = 0;
+  for(uint32_t i = 0; i < 1000; i++){
+    uint16_t len = (uint16_t) (test_random() % sizeof(data));
+    for(uint16_t j = 0; j < len; j++){data[j] = (uint8_t) test_random();}
+    /* Split in two calls, the CRC continues across them */
+    uint16_t split = len / 2;
+    uint16_t crc = mjl_telem_crc16(MJL_TELEM_CRC_INIT, data, split);
+    crc = mjl_telem_crc16(crc, &data[split], len - split);
+    if(crc != test_crc16(data, len)){mismatches++;}
+  }
+  TEST_CHECK(0 == mismatches);
+}
+
+/* Frames of random samples sent through the uart, then every byte of some
+ * corrupted and every length short of the whole cut off */
+static void test_frames(void){
+  static TEST_SAMPLE_S samples[TEST_SAMPLES_MAX];
+  uint8_t bad[MJL_TELEM_BUFFER_LEN(TEST_SAMPLES_MAX)];
+  int mismatches = 0;
+  int accepted = 0;
+  for(uint16_t seq = 0; seq < TEST_FRAMES; seq++){
+    uint8_t count = (uint8_t) (1 + (test_random() % TEST_SAMPLES_MAX));
+    uart_hostSCB_clearCapture();
+    uint32_t error = 0;
+    for(uint8_t i = 0; i < count; i++){
+      samples[i].channel = (uint8_t) test_random();
+      samples[i].kind = (MJL_TELEM_KIND_T) (test_random() % MJL_TELEM_KIND_NUM);
+      samples[i].value = test_random() >> (test_random() % 32u);
+      switch(samples[i].kind){
+        case MJL_TELEM_KIND_I16:  error |= mjl_telem_addI16(&telem, samples[i].channel, (int16_t) samples[i].value); break;
+        case MJL_TELEM_KIND_I32:  error |= mjl_telem_addI32(&telem, samples[i].channel, (int32_t) samples[i].value); break;
+        case MJL_TELEM_KIND_U32:  error |= mjl_telem_addU32(&telem, samples[i].channel, samples[i].value); break;
+        default: {
+          float val;
+          memcpy(&val, &samples[i].value, sizeof(val));
+          error |= mjl_telem_addFloat(&telem, samples[i].channel, val);
+          break;
+        }
+      }
+    }
+    error |= mjl_telem_flush(&telem);
+    TEST_CHECK(0 == error);
+    uint16_t len = 0;
+    const uint8_t *capture = uart_hostSCB_getCapture(&len);
+    /* One frame, ending at its delimiter */
+    bool isFrame = (len > 1) && (0 == capture[len - 1]) && (NULL == memchr(capture, 0, len - 1u));
+    if(!isFrame || !test_frameCheck(capture, len - 1u, seq, ticks, samples, count)){
+      mismatches++;
+      continue;
+    }
+    if(seq % 25){continue;}
+    for(uint16_t i = 0; i < (len - 1u); i++){
+      memcpy(bad, capture, len - 1u);
+      bad[i] ^= (uint8_t) (1 + (test_random() % 255u));
+      /* A zero splits the frame, the part up to it is decoded alone */
+      uint16_t badLen = (0 == bad[i]) ? i : (len - 1u);
+      if(test_frameCheck(bad, badLen, seq, ticks, samples, count)){accepted++;}
+    }
+    for(uint16_t cut = 1; cut < (len - 1u); cut++){
+      if(test_frameCheck(capture, len - 1u - cut, seq, ticks, samples, count)){accepted++;}
+    }
+  }
+  TEST_CHECK(0 == mismatches);
+  TEST_CHECK(0 == accepted);
+  TEST_CHECK(TEST_FRAMES == telem.framesSent);
+  TEST_CHECK(0 == telem.framesDropped);
+}
+
+int main(void){
+  MJL_UART_CFG_S uartCfg = uart_cfg_default;
+  uartCfg.hal_req_writeArray = uart_hostSCB_writeArrayBlocking;
+  uartCfg.hal_req_read = uart_hostSCB_read;
+  uartCfg.hal_opt_externalStart = uart_hostSCB_start;
+  uart_hostSCB_reset();
+  TEST_CHECK(0 == uart_init(&uart, &uartCfg));
+  TEST_CHECK(0 == uart_start(&uart));
+  MJL_TELEM_CFG_S telemCfg = mjl_telem_cfg_default;
+  telemCfg.uart = &uart;
+  telemCfg.buffer = frame;
+  telemCfg.bufferLen = sizeof(frame);
+  telemCfg.opt_getTicks = test_getTicks;
+  TEST_CHECK(0 == mjl_telem_init(&telem, &telemCfg));
+
+  srand(13);
+  test_crc();
+  test_cobs();
+  test_frames();
+  return test_report("test_telemetry");
+}
+
+/* [] END OF FILE */
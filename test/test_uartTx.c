@@ -0,0 +1,99 @@
+/***************************************************************************
+*                                Majestic Labs © 2026
+* File: test_uartTx.c
+* Workspace: MJL Driver Library
+* Version: v1.0.0
+* Author: C. Cheney
+* Target: Host (PC)
+*
+* Brief: Host test of the uart TX ring draining to a FIFO that has room, and
+*   of uart_flush() and blocked writes giving up with ERROR_TIMEOUT when the
+*   FIFO or the DMA stops taking bytes
+*
+* 2026.10.16  - Document Created
+********************************************************************************/
+#include "test_host.h"
+#include "mjl_uart.h"
+#include "hal_host.h"
+#include <string.h>
+
+#define TEST_RING_LEN   (64)
+
+static MLJ_UART_S uart;
+static uint8_t txBuffer[TEST_RING_LEN];
+static uint8_t data[100];
+static uint32_t txFree = 0;
+
+/* TX FIFO with txFree bytes of room on every call */
+static uint32_t test_getTxFree(void){
+  return txFree;
+}
+
+/* DMA that never completes */
+static uint32_t test_dmaStart(MJL_DMA_DESC_S *const desc){
+  (void) desc;
+  return 0;
+}
+
+static void test_init(bool isDma){
+  uart_hostSCB_reset();
+  MJL_UART_CFG_S cfg = uart_cfg_default;
+  cfg.hal_req_writeArray = uart_hostSCB_writeArrayBlocking;
+  cfg.hal_req_read = uart_hostSCB_read;
+  cfg.hal_opt_criticalEnter = critical_host_enter;
+  cfg.hal_opt_criticalExit = critical_host_exit;
+  if(isDma){
+    cfg.hal_opt_dmaStart = test_dmaStart;
+  }
+  else {
+    cfg.hal_opt_getTxFree = test_getTxFree;
+    cfg.hal_opt_setTxIrq = uart_hostSCB_setTxIrq;
+  }
+  cfg.opt_txBuffer = txBuffer;
+  cfg.opt_txBufferLen = sizeof(txBuffer);
+  TEST_CHECK(0 == uart_init(&uart, &cfg));
+  TEST_CHECK(0 == uart_start(&uart));
+}
+
+/* Bytes handed to the FIFO */
+static uint32_t test_sent(void){
+  HAL_HOST_UART_STATS_S stats;
+  uart_hostSCB_getStats(&stats);
+  return stats.bytes;
+}
+
+int main(void){
+  for(uint8_t i = 0; i < sizeof(data); i++){data[i] = i;}
+  /* A FIFO with room drains a write longer than the ring */
+  test_init(false);
+  txFree = 8;
+  TEST_CHECK(0 == uart_writeArray(&uart, data, sizeof(data)));
+  TEST_CHECK(0 == uart_flush(&uart));
+  TEST_CHECK(sizeof(data) == test_sent());
+  uint16_t len = 0;
+  const uint8_t *capture = uart_hostSCB_getCapture(&len);
+  TEST_CHECK((sizeof(data) == len) && (0 == memcmp(capture, data, len)));
+
+  /* A stuck FIFO times the flush out instead of hanging */
+  test_init(false);
+  txFree = 0;
+  TEST_CHECK(0 == uart_writeArray(&uart, data, TEST_RING_LEN / 2));
+  TEST_CHECK(ERROR_TIMEOUT == uart_flush(&uart));
+  /* and a write waiting for space, which keeps what fitted */
+  TEST_CHECK(ERROR_TIMEOUT == uart_writeArray(&uart, data, sizeof(data)));
+  TEST_CHECK(TEST_RING_LEN == uart._txRing.count);
+  TEST_CHECK(0 == test_sent());
+  /* Draining again once the FIFO has room */
+  txFree = 8;
+  TEST_CHECK(0 == uart_flush(&uart));
+  TEST_CHECK(TEST_RING_LEN == test_sent());
+
+  /* A DMA that never completes */
+  test_init(true);
+  TEST_CHECK(0 == uart_writeArray(&uart, data, TEST_RING_LEN / 2));
+  TEST_CHECK(ERROR_TIMEOUT == uart_flush(&uart));
+  TEST_CHECK(TEST_RING_LEN / 2 == uart._txInFlight);
+  return test_report("test_uartTx");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,214 @@
+#!/usr/bin/env python3
+# Decoder for the deferred binary log of mjl_log.h
+# Created on 2026.10.16 by C. Cheney
+# Example usage:
+# $ python3 tools/mjl_log_decode.py build/app.elf capture.bin
+# $ cat /dev/ttyACM0 | python3 tools/mjl_log_decode.py build/app.elf -
+#
+# Format strings are read from the mjl_log section of the ELF the capture was
+# produced by. Bytes outside of frames, such as uart_printf() text, are
+# passed through unchanged.
+import argparse
+import math
+import struct
+import sys
+
+LOG_SECTION = "mjl_log"
+SYNC = 0xA6
+SYNC_TICKS = 0xA7
+ARGS_MAX = 8
+PREC_DEFAULT = 6
+PREC_MAX = 9
+FLOAT_MAX = 1e9
+SHT_NOBITS = 8
+
+
+class Elf:
+    """Sections of a little endian ELF32 or ELF64 file"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[5] != 1:
+            raise ValueError("%s is not a little endian ELF file" % path)
+        is64 = self.data[4] == 2
+        if is64:
+            shoff, = struct.unpack_from("<Q", self.data, 0x28)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x3A)
+            fmt = "<IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from("<I", self.data, 0x20)
+            shentsize, shnum, shstrndx = struct.unpack_from("<HHH", self.data, 0x2E)
+            fmt = "<IIIIIIIIII"
+        headers = []
+        for i in range(shnum):
+            name, stype, _, addr, offset, size = struct.unpack_from(fmt, self.data, shoff + i * shentsize)[:6]
+            headers.append((name, stype, addr, offset, size))
+        strtab = headers[shstrndx]
+        self.sections = {}
+        for name, stype, addr, offset, size in headers:
+            end = self.data.index(b"\0", strtab[3] + name)
+            label = self.data[strtab[3] + name:end].decode()
+            self.sections[label] = (stype, addr, offset, size)
+
+    def section(self, name):
+        stype, addr, offset, size = self.sections[name]
+        return self.data[offset:offset + size]
+
+    def string_at(self, address):
+        """Zero terminated string at a load address, None when not in the file"""
+        for stype, addr, offset, size in self.sections.values():
+            if stype != SHT_NOBITS and addr and addr <= address < addr + size:
+                start = offset + address - addr
+                return self.data[start:self.data.index(b"\0", start)].decode(errors="replace")
+        return None
+
+
+def count_args(fmt):
+    """Arguments consumed by a format string, following uart_vprintf()"""
+    count = 0
+    i = 0
+    while i < len(fmt):
+        if fmt[i] != "%":
+            i += 1
+            continue
+        i += 1
+        if i < len(fmt) and fmt[i] in "sbudicxXf":
+            count += 1
+            i += 1
+        elif i < len(fmt) and fmt[i] == ".":
+            count += 1
+            i += 3
+    return count
+
+
+def format_float(bits, prec):
+    val, = struct.unpack("<f", struct.pack("<I", bits))
+    if math.isnan(val):
+        return "NaN"
+    if math.isinf(val):
+        return "-inf" if val < 0 else "+inf"
+    if abs(val) > FLOAT_MAX:
+        return "*reqEXP"
+    text = "%.*f" % (prec, val)
+    return text[1:] if val == 0 and text.startswith("-") else text
+
+
+def format_hex(val):
+    text = "%X" % val
+    return text if len(text) % 2 == 0 else "0" + text
+
+
+def render(fmt, args, elf):
+    """Text uart_printf() would have written for fmt and the argument words"""
+    out = []
+    args = iter(args)
+    i = 0
+    while i < len(fmt):
+        if fmt[i] != "%":
+            out.append(fmt[i])
+            i += 1
+            continue
+        i += 1
+        spec = fmt[i] if i < len(fmt) else ""
+        if spec == "s":
+            address = next(args)
+            text = elf.string_at(address)
+            out.append(text if text is not None else "<0x%08X>" % address)
+        elif spec == "b":
+            out.append("True" if next(args) else "False")
+        elif spec == "u":
+            out.append(str(next(args)))
+        elif spec and spec in "di":
+            val = next(args)
+            out.append(str(val - (1 << 32) if val & 0x80000000 else val))
+        elif spec == "c":
+            out.append(chr(next(args) & 0xFF))
+        elif spec == "x":
+            out.append(format_hex(next(args) & 0xFFFF))
+        elif spec == "X":
+            out.append(format_hex(next(args)))
+        elif spec == "f":
+            out.append(format_float(next(args), PREC_DEFAULT))
+        elif spec == ".":
+            prec = min(ord(fmt[i + 1]) - ord("0"), PREC_MAX) if i + 1 < len(fmt) else PREC_DEFAULT
+            out.append(format_float(next(args), prec))
+            i += 2
+        else:
+            continue
+        i += 1
+    return "".join(out)
+
+
+class Decoder:
+    def __init__(self, elf, stream):
+        self.elf = elf
+        self.strings = elf.section(LOG_SECTION)
+        self.stream = stream
+        self.buf = bytearray()
+
+    def format_at(self, offset):
+        """Format string starting at an offset of the section, None if there is none"""
+        if offset >= len(self.strings) or (offset and self.strings[offset - 1] != 0):
+            return None
+        end = self.strings.index(b"\0", offset)
+        return self.strings[offset:end].decode(errors="replace")
+
+    def feed(self, data, final=False):
+        self.buf += data
+        while self.buf:
+            sync = self.buf[0]
+            if sync not in (SYNC, SYNC_TICKS):
+                end = len(self.buf)
+                for marker in (SYNC, SYNC_TICKS):
+                    idx = self.buf.find(bytes([marker]))
+                    if idx >= 0:
+                        end = min(end, idx)
+                self.stream.write(self.buf[:end].decode(errors="replace"))
+                del self.buf[:end]
+                continue
+            if len(self.buf) < 3:
+                break
+            offset = self.buf[1] | (self.buf[2] << 8)
+            fmt = self.format_at(offset)
+            num = count_args(fmt) if fmt is not None else 0
+            if fmt is None or num > ARGS_MAX:
+                # Not a frame, pass the byte through and resynchronise
+                self.stream.write(bytes(self.buf[:1]).decode(errors="replace"))
+                del self.buf[:1]
+                continue
+            head = 3 + (4 if sync == SYNC_TICKS else 0)
+            length = head + 4 * num
+            if len(self.buf) < length:
+                break
+            prefix = ""
+            if sync == SYNC_TICKS:
+                ticks, = struct.unpack_from("<I", self.buf, 3)
+                prefix = "[%10u] " % ticks
+            args = struct.unpack_from("<%dI" % num, self.buf, head)
+            self.stream.write(prefix + render(fmt, args, self.elf).rstrip("\r\n") + "\n")
+            del self.buf[:length]
+        if final and self.buf:
+            self.stream.write(self.buf.decode(errors="replace"))
+            self.buf.clear()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode an mjl_log capture")
+    parser.add_argument("elf", help="ELF file of the firmware that wrote the capture")
+    parser.add_argument("capture", help="Binary capture of the uart, - for stdin")
+    args = parser.parse_args()
+    decoder = Decoder(Elf(args.elf), sys.stdout)
+    source = sys.stdin.buffer if args.capture == "-" else open(args.capture, "rb")
+    with source:
+        while True:
+            data = source.read1(4096) if hasattr(source, "read1") else source.read(4096)
+            if not data:
+                break
+            decoder.feed(data)
+            sys.stdout.flush()
+    decoder.feed(b"", final=True)
+
+
+if __name__ == "__main__":
+    main()
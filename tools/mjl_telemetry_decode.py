@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+# Decoder for the binary telemetry frames of mjl_telemetry.h
+# Created on 2026.10.16 by C. Cheney
+# Example usage:
+# $ python3 tools/mjl_telemetry_decode.py capture.bin > samples.csv
+# $ cat /dev/ttyACM0 | python3 tools/mjl_telemetry_decode.py -
+#
+# Writes one CSV line per sample: seq,ticks,channel,kind,value
+# Lost frames, from gaps in the sequence numbers, and frames failing the CRC
+# are counted and reported on stderr at the end.
+import argparse
+import struct
+import sys
+
+VERSION = 1
+HEADER_LEN = 8
+CRC_LEN = 2
+CRC_INIT = 0xFFFF
+KINDS = {0: ("i16", "<h"), 1: ("i32", "<i"), 2: ("u32", "<I"), 3: ("float", "<f")}
+
+
+def crc16(data, crc=CRC_INIT):
+    """CRC-16/CCITT-FALSE"""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else (crc << 1)
+        crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    """Raw bytes of one frame without its delimiter, None when malformed"""
+    out = bytearray()
+    idx = 0
+    while idx < len(data):
+        code = data[idx]
+        if code == 0 or idx + code > len(data):
+            return None
+        out += data[idx + 1:idx + code]
+        idx += code
+        if code < 0xFF and idx < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def parse(raw):
+    """(seq, ticks, [(channel, kind, value)]), None when malformed"""
+    if len(raw) < HEADER_LEN + CRC_LEN or raw[0] != VERSION:
+        return None
+    if crc16(raw[:-CRC_LEN]) != struct.unpack_from("<H", raw, len(raw) - CRC_LEN)[0]:
+        return None
+    seq, ticks, count = struct.unpack_from("<HIB", raw, 1)
+    samples = []
+    idx = HEADER_LEN
+    for _ in range(count):
+        if idx + 2 > len(raw) - CRC_LEN or raw[idx + 1] not in KINDS:
+            return None
+        channel, kind = raw[idx], raw[idx + 1]
+        name, fmt = KINDS[kind]
+        value, = struct.unpack_from(fmt, raw, idx + 2)
+        samples.append((channel, name, value))
+        idx += 2 + struct.calcsize(fmt)
+    if idx != len(raw) - CRC_LEN:
+        return None
+    return seq, ticks, samples
+
+
+class Decoder:
+    def __init__(self, stream, quiet=False):
+        self.stream = stream
+        self.quiet = quiet
+        self.buf = bytearray()
+        self.last_seq = None
+        self.frames = 0
+        self.samples = 0
+        self.corrupt = 0
+        self.lost = 0
+
+    def frame(self, data):
+        raw = cobs_decode(data)
+        result = parse(raw) if raw is not None else None
+        if result is None:
+            self.corrupt += 1
+            return
+        seq, ticks, samples = result
+        if self.last_seq is not None:
+            self.lost += (seq - self.last_seq - 1) & 0xFFFF
+        self.last_seq = seq
+        self.frames += 1
+        self.samples += len(samples)
+        if not self.quiet:
+            for channel, kind, value in samples:
+                text = "%.9g" % value if kind == "float" else str(value)
+                self.stream.write("%u,%u,%u,%s,%s\n" % (seq, ticks, channel, kind, text))
+
+    def feed(self, data):
+        self.buf += data
+        while True:
+            end = self.buf.find(b"\0")
+            if end < 0:
+                break
+            if end:
+                self.frame(bytes(self.buf[:end]))
+            del self.buf[:end + 1]
+
+    def summary(self):
+        return "frames %u, samples %u, lost frames %u, corrupt frames %u" % (
+            self.frames, self.samples, self.lost, self.corrupt)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode an mjl_telemetry capture")
+    parser.add_argument("capture", help="Binary capture of the uart, - for stdin")
+    parser.add_argument("-q", "--quiet", action="store_true", help="Only print the summary")
+    args = parser.parse_args()
+    decoder = Decoder(sys.stdout, args.quiet)
+    source = sys.stdin.buffer if args.capture == "-" else open(args.capture, "rb")
+    with source:
+        while True:
+            data = source.read1(4096) if hasattr(source, "read1") else source.read(4096)
+            if not data:
+                break
+            decoder.feed(data)
+    sys.stdout.flush()
+    sys.stderr.write(decoder.summary() + "\n")
+
+
+if __name__ == "__main__":
+    main()